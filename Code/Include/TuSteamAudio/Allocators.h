@@ -12,4 +12,66 @@
 namespace TuSteamAudio
 {
     AZ_CHILD_ALLOCATOR_WITH_NAME(SteamAudioAllocator, "SteamAudioAllocator", "{5D29062B-71AF-4DD4-828C-42476C7B2EA8}", AZ::SystemAllocator);
-}
\ No newline at end of file
+
+    //! Marks the calling thread as real-time for as long as it lives, scopes nest.
+    //! With sa_AssertRealtimeAllocations on, Steam Audio allocating or freeing inside one asserts.
+    class RealtimeScope
+    {
+    public:
+        RealtimeScope() { ++s_depth; }
+        ~RealtimeScope() { --s_depth; }
+        RealtimeScope(const RealtimeScope&) = delete;
+        RealtimeScope& operator=(const RealtimeScope&) = delete;
+
+        static bool IsActive() { return s_depth > 0; }
+
+    private:
+        static inline thread_local int s_depth = 0;
+    };
+
+    //! What Steam Audio was doing when it allocated, tracked separately by the Phonon allocator.
+    //! Anything inside a RealtimeScope counts as Render whatever the scope says.
+    enum class PhononAllocationCategory : AZ::u8
+    {
+        General,
+        Render,
+        Simulation,
+        Scene,
+        Probes,
+        //! Per source reflection effects, created on demand by the game thread
+        Reflections
+    };
+    static constexpr int PhononAllocationCategoryCount = 6;
+
+    //! Allocation totals of one PhononAllocationCategory, in the sizes Steam Audio asked for.
+    struct PhononAllocationStats
+    {
+        AZ::u64 m_liveBytes = 0;
+        AZ::u64 m_peakBytes = 0;
+        AZ::u64 m_allocations = 0;
+        AZ::u64 m_frees = 0;
+    };
+
+    //! Tags the Steam Audio allocations the calling thread makes for as long as it lives, scopes nest.
+    class PhononAllocationScope
+    {
+    public:
+        explicit PhononAllocationScope(PhononAllocationCategory category)
+            : m_previous(s_current)
+        {
+            s_current = category;
+        }
+        ~PhononAllocationScope() { s_current = m_previous; }
+        PhononAllocationScope(const PhononAllocationScope&) = delete;
+        PhononAllocationScope& operator=(const PhononAllocationScope&) = delete;
+
+        static PhononAllocationCategory GetCurrent()
+        {
+            return RealtimeScope::IsActive() ? PhononAllocationCategory::Render : s_current;
+        }
+
+    private:
+        PhononAllocationCategory m_previous;
+        static inline thread_local PhononAllocationCategory s_current = PhononAllocationCategory::General;
+    };
+}
@@ -0,0 +1,151 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "Types.h"
+
+#include <AzCore/std/containers/array.h>
+#include <cmath>
+
+namespace TuSteamAudio
+{
+    namespace Attenuation
+    {
+        //! One evaluator per curve, so a table fill or a hot loop picks the curve once instead of per sample.
+        //! normalizedDistance is 0 at the inner radius and 1 at the end of the falloff.
+        //! MaxSecondDerivative bounds |d²f/du²| over the falloff, u being the normalized distance.
+        template<TuAttenuation::CurveType Curve>
+        struct CurveEvaluator;
+
+        template<>
+        struct CurveEvaluator<TuAttenuation::CurveType::Linear>
+        {
+            static float Evaluate(float normalizedDistance, float, float)
+            {
+                return 1.0f - normalizedDistance;
+            }
+            static float MaxSecondDerivative(float, float) { return 0.0f; }
+        };
+
+        template<>
+        struct CurveEvaluator<TuAttenuation::CurveType::Logarithmic>
+        {
+            static float Evaluate(float normalizedDistance, float, float)
+            {
+                // Log base 10: log10(x) = log(x) / log(10)
+                return 1.0f - (std::log(normalizedDistance * 9.0f + 1.0f) / std::log(10.0f));
+            }
+            // 81 / (ln10 (9u + 1)²), largest at the inner radius
+            static float MaxSecondDerivative(float, float) { return 81.0f / std::log(10.0f); }
+        };
+
+        template<>
+        struct CurveEvaluator<TuAttenuation::CurveType::Inverse>
+        {
+            // Inverse distance: 1/d falloff. Without an inner radius it is silent right away, and the table's
+            // first sample at d = 0 doesn't divide 0 by 0
+            static float Evaluate(float, float distance, float innerRadius)
+            {
+                return innerRadius > 0.0f ? innerRadius / distance : 0.0f;
+            }
+            // 2ab² / (a + bu)³ with a the inner radius and b the falloff, largest at the inner radius
+            static float MaxSecondDerivative(float innerRadius, float falloffDistance)
+            {
+                return innerRadius > 0.0f ? 2.0f * (falloffDistance * falloffDistance) / (innerRadius * innerRadius) : 0.0f;
+            }
+        };
+
+        template<>
+        struct CurveEvaluator<TuAttenuation::CurveType::LogReverse>
+        {
+            static float Evaluate(float normalizedDistance, float, float)
+            {
+                return std::log((1.0f - normalizedDistance) * 9.0f + 1.0f) / std::log(10.0f);
+            }
+            // 81 / (ln10 (10 - 9u)²), largest at the end of the falloff
+            static float MaxSecondDerivative(float, float) { return 81.0f / std::log(10.0f); }
+        };
+
+        template<>
+        struct CurveEvaluator<TuAttenuation::CurveType::NaturalSound>
+        {
+            // Inverse square law: 1/d² (physically accurate for sound)
+            static float Evaluate(float, float distance, float innerRadius)
+            {
+                // Same as Inverse without an inner radius
+                const float ratio = innerRadius > 0.0f ? innerRadius / distance : 0.0f;
+                return ratio * ratio;
+            }
+            // 6a²b² / (a + bu)⁴ with a the inner radius and b the falloff, largest at the inner radius
+            static float MaxSecondDerivative(float innerRadius, float falloffDistance)
+            {
+                return innerRadius > 0.0f ? 6.0f * (falloffDistance * falloffDistance) / (innerRadius * innerRadius) : 0.0f;
+            }
+        };
+
+        //! TuAttenuation compiled into a dense table over the falloff, read back with linear interpolation.
+        //! Shared by the renderers and the editor graphs so every one of them hears and draws the same curve.
+        //!
+        //! Error: linear interpolation between samples h apart is off by at most h²/8 * max|f''|, with
+        //! h = 1 / Resolution in normalized distance. Build works that bound out for the curve it compiled
+        //! and GetMaxError returns it. Linear is exact, both logarithmic curves stay under 5e-6. Inverse and
+        //! NaturalSound grow with (falloff / inner radius)², a 1m inner radius over 100m of falloff gives
+        //! 2.4e-3 and 7.2e-3, all of it right next to the inner radius where the curve is near 1.
+        //! A falloff under FloatEpsilon is sampled as FloatEpsilon, the bound doesn't hold inside that sliver.
+        class AttenuationTable
+        {
+        public:
+            static constexpr AZ::u32 Resolution = 1024;
+
+            AttenuationTable();
+
+            //! Compiles settings into the table. Returns false without touching it when they compile to the
+            //! same curve as last time, so callers can hand it every settings change.
+            bool Build(const TuAttenuation& settings);
+
+            //! Gain at distance from the source, no branches on the curve type.
+            float Lookup(float distance) const
+            {
+                if (distance <= m_innerRadius)
+                {
+                    return 1.0f;
+                }
+                // Same test as CalculateAttenuation, comparing against inner + falloff rounds differently right at
+                // the edge, where the inverse curves drop to 0 from well above it
+                const float effectiveDistance = distance - m_innerRadius;
+                if (effectiveDistance >= m_falloffDistance)
+                {
+                    return 0.0f;
+                }
+
+                const float position = effectiveDistance * m_scale;
+                const AZ::u32 index = static_cast<AZ::u32>(position);
+                const float fraction = position - static_cast<float>(index);
+                return m_values[index] + (m_values[index + 1] - m_values[index]) * fraction;
+            }
+
+            //! Upper bound of |Lookup(d) - CalculateAttenuation(d)| over every distance.
+            float GetMaxError() const { return m_maxError; }
+            const TuAttenuation& GetSettings() const { return m_settings; }
+
+        private:
+            template<TuAttenuation::CurveType Curve>
+            void Fill();
+
+            TuAttenuation m_settings;
+            float m_innerRadius = 0.0f;
+            //! As set, a zero falloff is silent past the inner radius like the reference
+            float m_falloffDistance = 0.0f;
+            //! Table entries per metre of falloff
+            float m_scale = 0.0f;
+            float m_maxError = 0.0f;
+            //! Resolution + 1 samples across the falloff, the last one repeated so index + 1 stays in range
+            //! when float rounding puts a distance just short of the end onto the final sample.
+            AZStd::array<float, Resolution + 2> m_values = {};
+        };
+    }
+}
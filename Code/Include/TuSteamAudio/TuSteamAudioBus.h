@@ -6,10 +6,13 @@
  */
 #pragma once
 
+#include <TuSteamAudio/Allocators.h>
 #include <TuSteamAudio/TuSteamAudioTypeIds.h>
 
+#include <AzCore/Component/ComponentBus.h>
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/string/string.h>
 #include <Sune/PlayerAudioEffect.h>
 
 #include "phonon.h"
@@ -17,17 +20,62 @@
 
 namespace TuSteamAudio
 {
+    class SteamAudioSpatialMixerNode;
+    class SteamAudioReflectionMixerNode;
+    class AmbisonicsBus;
+    class SimulationManager;
+    class ListenerCache;
+    class AudibilityManager;
+    class QualityController;
+    class SpatializerPool;
+    class HrtfClient;
+
     class TuSteamAudioRequests
     {
     public:
         AZ_RTTI(TuSteamAudioRequests, TuSteamAudioRequestsTypeId);
         virtual ~TuSteamAudioRequests() = default;
 
+        //! Everything Phonon on this bus is null until Ready, what the settings and helpers return is usable from activation on.
+        virtual SystemReadiness GetReadiness() = 0;
+        //! Milliseconds the stage took during the last activation, 0 for stages that haven't run.
+        virtual double GetInitStageTime(InitStage stage) = 0;
+
         virtual IPLHRTF GetHrtf() = 0;
+        //! Loads the .sahrtf product at path, or the default HRTF if empty, without blocking the caller.
+        //! Every registered client crossfades to it once it is ready.
+        virtual void SetHrtf(const AZStd::string& path) = 0;
+        //! Game thread. Registered clients are moved onto every new HRTF, unregister before releasing their effects.
+        virtual void RegisterHrtfClient(HrtfClient* client) = 0;
+        virtual void UnregisterHrtfClient(HrtfClient* client) = 0;
         virtual IPLContext GetContext() = 0;
         virtual IPLAudioSettings GetAudioSettings() = 0;
         virtual IPLScene GetRootScene() = 0;
         virtual IPLSimulator GetSimulator() = 0;
+        virtual IPLSimulationSettings GetSimulationSettings() = 0;
+        virtual SimulationManager* GetSimulationManager() = 0;
+        virtual SteamAudioSpatialMixerNode* GetSpatialMixer() = 0;
+        //! Null unless reflections are simulated with the shared reflection mixer.
+        virtual std::shared_ptr<SteamAudioReflectionMixerNode> GetReflectionMixer() = 0;
+        virtual AmbisonicsBus* GetAmbisonicsBus() = 0;
+        //! Listener snapshot shared by every node, captured once per render quantum.
+        virtual ListenerCache* GetListenerCache() = 0;
+        //! Decides which HRTF voices heard by the listener render at Full, pan or go virtual.
+        virtual AudibilityManager* GetAudibilityManager() = 0;
+        //! Global spatialization quality, stepped down automatically to stay inside the audio CPU budget.
+        virtual QualityController* GetQualityController() = 0;
+        //! Initialized SteamAudioHrtf nodes kept between effects, null until Ready.
+        virtual SpatializerPool* GetSpatializerPool() = 0;
+        virtual SpatializerPoolStats GetSpatializerPoolStats() = 0;
+        //! What the Phonon context has allocated so far, split by what it was doing at the time.
+        virtual PhononAllocationStats GetPhononAllocationStats(PhononAllocationCategory category) = 0;
+
+        virtual SpatialRenderMode GetSpatialRenderMode() = 0;
+        //! Ambisonics falls back to Binaural if the shared bus could not be created.
+        virtual void SetSpatialRenderMode(SpatialRenderMode mode) = 0;
+
+        //! Drops the level geometry from the root scene and gathers it again.
+        virtual void RebuildAcousticScene() = 0;
     };
 
     class TuSteamAudioBusTraits
@@ -44,6 +92,22 @@ namespace TuSteamAudio
     using TuSteamAudioRequestBus = AZ::EBus<TuSteamAudioRequests, TuSteamAudioBusTraits>;
     using TuSteamAudioInterface = AZ::Interface<TuSteamAudioRequests>;
 
+    class TuSteamAudioNotifications
+        : public AZ::EBusTraits
+    {
+    public:
+        //////////////////////////////////////////////////////////////////////////
+        // EBusTraits overrides
+        static constexpr AZ::EBusHandlerPolicy HandlerPolicy = AZ::EBusHandlerPolicy::Multiple;
+        static constexpr AZ::EBusAddressPolicy AddressPolicy = AZ::EBusAddressPolicy::Single;
+        //////////////////////////////////////////////////////////////////////////
+
+        //! Main thread. Handlers connecting late check GetReadiness themselves, nothing is replayed on connect.
+        virtual void OnReadinessChanged([[maybe_unused]] SystemReadiness readiness) {}
+    };
+
+    using TuSteamAudioNotificationBus = AZ::EBus<TuSteamAudioNotifications>;
+
 
     class SteamAudioEffectRequests
     {
@@ -55,4 +119,14 @@ namespace TuSteamAudio
     };
 
     using SteamAudioEffectRequestBus = AZ::EBus<SteamAudioEffectRequests, Sune::PlayerEffectBusTraits>;
+
+    //! Implement on an entity to give its geometry an acoustic material other than the default preset.
+    class AcousticMaterialRequests
+        : public AZ::ComponentBus
+    {
+    public:
+        virtual IPLMaterial GetAcousticMaterial() = 0;
+    };
+
+    using AcousticMaterialRequestBus = AZ::EBus<AcousticMaterialRequests>;
 } // namespace TuSteamAudio
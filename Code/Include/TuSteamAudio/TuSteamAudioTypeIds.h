@@ -21,4 +21,13 @@ namespace TuSteamAudio
 
     // Interface TypeIds
     inline constexpr const char* TuSteamAudioRequestsTypeId = "{C5B90D4B-1F87-4A23-BA37-0E113DF93A50}";
+
+    // Asset TypeIds
+    inline constexpr const char* AcousticSceneAssetTypeId = "{4E0C2B71-8D3A-4F55-9C61-2A7B0E9D5F13}";
+    inline constexpr const char* AcousticProbesAssetTypeId = "{7A5D3C19-E2B4-4F86-8D07-C1F94B62A3E5}";
+    inline constexpr const char* HrtfAssetTypeId = "{35BF67BC-80A1-47EC-8035-54B48A5EC80E}";
+
+    // Builder TypeIds
+    inline constexpr const char* AcousticSceneAssetBuilderComponentTypeId = "{B3A91F0E-6C27-4D8B-A5E4-7F12C0D9E863}";
+    inline constexpr const char* HrtfAssetBuilderComponentTypeId = "{FE9A0B68-6189-46CB-82C3-978A75FCB94A}";
 } // namespace TuSteamAudio
@@ -18,6 +18,55 @@ namespace TuSteamAudio
         TuAttenuation
     };
 
+    //! How the spatial mixer renders its sources
+    enum class SpatialRenderMode
+    {
+        //! One HRTF convolution per source
+        Binaural,
+        //! Sources are encoded into a shared ambisonic bus, decoded binaurally once per quantum
+        Ambisonics
+    };
+
+    //! How far the system component has got bringing Steam Audio up
+    enum class SystemReadiness : AZ::u8
+    {
+        //! Not activated, or deactivated again
+        Uninitialized,
+        //! Stages running in the background, spatializers pass their input through with a plain pan
+        Initializing,
+        //! Context, HRTF, scene, simulator and the shared mixers are all usable
+        Ready,
+        //! A stage failed, spatializers keep the plain pan
+        Failed
+    };
+
+    //! Stages of system initialization, in the order they run
+    enum class InitStage : AZ::u8
+    {
+        Context,
+        Hrtf,
+        Scene,
+        Simulator,
+        //! Main thread, simulation threads, scene streaming and the shared mixers
+        Spatializers,
+        Count
+    };
+
+    //! Counters of the pool SteamAudioHrtf effects take their nodes from
+    struct SpatializerPoolStats
+    {
+        //! Effects that got a recycled node
+        AZ::u64 m_hits = 0;
+        //! Effects that had to create one, the pool being empty or not there yet
+        AZ::u64 m_misses = 0;
+        //! Nodes dropped on release because the pool was full or they never got spatialized
+        AZ::u64 m_discarded = 0;
+        //! Nodes ready to be handed out
+        AZ::u32 m_free = 0;
+        //! Nodes released that LabSound hasn't let go of yet
+        AZ::u32 m_pending = 0;
+    };
+
     namespace Attenuation
     {
         enum class Shape
@@ -56,6 +105,7 @@ namespace TuSteamAudio
 namespace AZ
 {
     AZ_TYPE_INFO_SPECIALIZE(TuSteamAudio::DistanceModel, "{8394C253-DD9B-4EC3-86AB-E5DE589764B7}");
+    AZ_TYPE_INFO_SPECIALIZE(TuSteamAudio::SpatialRenderMode, "{0E6B1E0B-5D0B-4C53-9E39-2B4D7C86A1F4}");
     AZ_TYPE_INFO_SPECIALIZE(TuSteamAudio::Attenuation::Shape, "{7F2AB445-1F17-458E-8F15-848F8E1879A0}");
     AZ_TYPE_INFO_SPECIALIZE(TuSteamAudio::Attenuation::CurveType, "{2A2EC65D-9918-42C8-8825-ED2088709941}");
 }
@@ -5,4 +5,5 @@
 #      ../Include/Android/TuSteamAudioAndroid.h
 
 set(FILES
+    ../Common/Unix/MappedFile_Unix.cpp
 )
@@ -0,0 +1,74 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include <Clients/Scene/MappedFile.h>
+
+#include <AzCore/PlatformIncl.h>
+#include <AzCore/std/string/conversions.h>
+
+using namespace TuSteamAudio;
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+bool MappedFile::Open(const char* path)
+{
+    Close();
+
+    AZStd::wstring widePath;
+    AZStd::to_wstring(widePath, path);
+
+    HANDLE file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return false;
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    // The mapping object keeps the file open
+    CloseHandle(file);
+    if (!mapping)
+    {
+        return false;
+    }
+
+    const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data)
+    {
+        CloseHandle(mapping);
+        return false;
+    }
+
+    m_data = static_cast<const AZ::u8*>(data);
+    m_size = static_cast<size_t>(size.QuadPart);
+    m_mapping = mapping;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (m_data)
+    {
+        UnmapViewOfFile(m_data);
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    if (m_mapping)
+    {
+        CloseHandle(static_cast<HANDLE>(m_mapping));
+        m_mapping = nullptr;
+    }
+}
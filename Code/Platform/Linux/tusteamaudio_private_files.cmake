@@ -5,4 +5,5 @@
 #      ../Include/Linux/TuSteamAudioLinux.h
 
 set(FILES
+    ../Common/Unix/MappedFile_Unix.cpp
 )
@@ -5,4 +5,5 @@
 #      ../Include/Mac/TuSteamAudioMac.h
 
 set(FILES
+    ../Common/Unix/MappedFile_Unix.cpp
 )
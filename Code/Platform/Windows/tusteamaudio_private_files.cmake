@@ -5,4 +5,5 @@
 #      ../Include/Windows/TuSteamAudioWindows.h
 
 set(FILES
+    ../Common/WinAPI/MappedFile_WinAPI.cpp
 )
@@ -5,4 +5,5 @@
 #      ../Include/iOS/TuSteamAudioiOS.h
 
 set(FILES
+    ../Common/Unix/MappedFile_Unix.cpp
 )
@@ -0,0 +1,75 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include <TuSteamAudio/AttenuationTable.h>
+
+#include <AzCore/Math/MathUtils.h>
+
+using namespace TuSteamAudio;
+
+Attenuation::AttenuationTable::AttenuationTable()
+{
+    // Matches the default settings, so the first Build with them is a no-op
+    Fill<TuAttenuation::CurveType::Linear>();
+}
+
+bool Attenuation::AttenuationTable::Build(const TuAttenuation& settings)
+{
+    // Shape and exponent don't change the curve yet
+    if (settings.m_innerRadius == m_settings.m_innerRadius &&
+        settings.m_falloffDistance == m_settings.m_falloffDistance &&
+        settings.m_curveType == m_settings.m_curveType)
+    {
+        return false;
+    }
+    m_settings = settings;
+
+    switch (settings.m_curveType)
+    {
+    case TuAttenuation::CurveType::Linear:
+        Fill<TuAttenuation::CurveType::Linear>();
+        break;
+    case TuAttenuation::CurveType::Logarithmic:
+        Fill<TuAttenuation::CurveType::Logarithmic>();
+        break;
+    case TuAttenuation::CurveType::Inverse:
+        Fill<TuAttenuation::CurveType::Inverse>();
+        break;
+    case TuAttenuation::CurveType::LogReverse:
+        Fill<TuAttenuation::CurveType::LogReverse>();
+        break;
+    case TuAttenuation::CurveType::NaturalSound:
+        Fill<TuAttenuation::CurveType::NaturalSound>();
+        break;
+    }
+    return true;
+}
+
+template<Attenuation::TuAttenuation::CurveType Curve>
+void Attenuation::AttenuationTable::Fill()
+{
+    using Evaluator = CurveEvaluator<Curve>;
+
+    const float innerRadius = m_settings.m_innerRadius;
+    // Lookup never interpolates past a zero falloff, the clamp only keeps the scale finite
+    const float falloffDistance = AZ::GetMax(m_settings.m_falloffDistance, AZ::Constants::FloatEpsilon);
+
+    m_innerRadius = innerRadius;
+    m_falloffDistance = m_settings.m_falloffDistance;
+    m_scale = static_cast<float>(Resolution) / falloffDistance;
+
+    for (AZ::u32 i = 0; i <= Resolution; ++i)
+    {
+        const float normalizedDistance = static_cast<float>(i) / static_cast<float>(Resolution);
+        const float distance = innerRadius + falloffDistance * normalizedDistance;
+        m_values[i] = AZ::GetClamp(Evaluator::Evaluate(normalizedDistance, distance, innerRadius), 0.0f, 1.0f);
+    }
+    m_values[Resolution + 1] = m_values[Resolution];
+
+    // h²/8 * max|f''|, clamping to [0, 1] only ever brings samples closer to the curve
+    const float step = 1.0f / static_cast<float>(Resolution);
+    m_maxError = AZ::GetMin(step * step * 0.125f * Evaluator::MaxSecondDerivative(innerRadius, falloffDistance), 1.0f);
+}
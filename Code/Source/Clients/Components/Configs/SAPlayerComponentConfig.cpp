@@ -18,5 +18,6 @@ void SAPlayerComponentConfig::Reflect(AZ::ReflectContext* context)
     sc->Class<SAPlayerComponentConfig>()
         ->Version(0)
         ->Field("distanceModel", &SAPlayerComponentConfig::m_distanceModel)
-        ->Field("attenuation", &SAPlayerComponentConfig::m_attenuation);
+        ->Field("attenuation", &SAPlayerComponentConfig::m_attenuation)
+        ->Field("batchedSpatialization", &SAPlayerComponentConfig::m_batchedSpatialization);
 }
@@ -18,5 +18,7 @@ namespace TuSteamAudio
 
         DistanceModel m_distanceModel = DistanceModel::TuAttenuation;
         Attenuation::TuAttenuation m_attenuation = {};
+        //! Registers with the shared spatial mixer instead of owning a spatializer node
+        bool m_batchedSpatialization = false;
     };
 } // TuSteamAudio
\ No newline at end of file
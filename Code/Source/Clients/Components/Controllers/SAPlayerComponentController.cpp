@@ -7,8 +7,11 @@
 #include "SAPlayerComponentController.h"
 
 #include "Clients/Effects/SteamAudioHrtf.h"
+#include "Clients/Effects/SteamAudioSpatialSource.h"
 #include "Sune/AudioPlayerBus.h"
 
+#include <AzCore/Settings/SettingsRegistry.h>
+
 using namespace TuSteamAudio;
 
 SAPlayerComponentController::SAPlayerComponentController(const SAPlayerComponentConfig& config)
@@ -67,10 +70,19 @@ void SAPlayerComponentController::Activate(const AZ::EntityComponentIdPair& enti
         m_hrtfId,
         m_playerId,
         &Sune::SoundPlayerRequestBus::Events::AddEffect,
-        SteamAudioHrtf::RegisterName);
+        m_config.m_batchedSpatialization ? SteamAudioSpatialSource::RegisterName : SteamAudioHrtf::RegisterName);
 
     OnConfigurationUpdated();
 
+    // The batched mixer doesn't interpolate, it keeps getting every change
+    m_transformInterval = 0.0f;
+    double updateRate = 0.0;
+    auto* registry = AZ::SettingsRegistry::Get();
+    if (!m_config.m_batchedSpatialization && registry && registry->Get(updateRate, "/TuSteamAudio/Spatializer/TransformUpdateRate") && updateRate > 0.0)
+    {
+        m_transformInterval = static_cast<float>(1.0 / updateRate);
+    }
+
     AZ::Transform transform = AZ::Transform::CreateIdentity();
     AZ::TransformBus::EventResult(transform, entityComponentIdPair.GetEntityId(), &AZ::TransformBus::Events::GetWorldTM);
     OnTransformChanged({}, transform);
@@ -80,7 +92,9 @@ void SAPlayerComponentController::Activate(const AZ::EntityComponentIdPair& enti
 
 void SAPlayerComponentController::Deactivate()
 {
+    AZ::TickBus::Handler::BusDisconnect();
     AZ::TransformNotificationBus::Handler::BusDisconnect();
+    m_hasPendingTransform = false;
 
     if (m_hrtfId != Sune::PlayerEffectId())
     {
@@ -98,9 +112,52 @@ void SAPlayerComponentController::OnConfigurationUpdated()
 }
 
 void SAPlayerComponentController::OnTransformChanged(const AZ::Transform& _, const AZ::Transform& transform)
+{
+    m_pendingTransform = transform;
+
+    if (m_transformInterval <= 0.0f)
+    {
+        SendTransform();
+        return;
+    }
+
+    if (AZ::TickBus::Handler::BusIsConnected())
+    {
+        // Goes out on the tick that ends the interval
+        m_hasPendingTransform = true;
+        return;
+    }
+
+    // First change after being still goes out straight away and starts the interval
+    SendTransform();
+    m_timeSinceTransform = 0.0f;
+    AZ::TickBus::Handler::BusConnect();
+}
+
+void SAPlayerComponentController::OnTick(float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+{
+    m_timeSinceTransform += deltaTime;
+    if (m_timeSinceTransform < m_transformInterval)
+    {
+        return;
+    }
+
+    if (!m_hasPendingTransform)
+    {
+        // Stopped moving, nothing to send until the next change
+        AZ::TickBus::Handler::BusDisconnect();
+        return;
+    }
+
+    SendTransform();
+    m_hasPendingTransform = false;
+    m_timeSinceTransform = 0.0f;
+}
+
+void SAPlayerComponentController::SendTransform()
 {
     Sune::PlayerEffectSpatializationRequestBus::Event(
         m_hrtfId,
         &Sune::PlayerEffectSpatializationRequestBus::Events::SetTransform,
-        transform);
+        m_pendingTransform);
 }
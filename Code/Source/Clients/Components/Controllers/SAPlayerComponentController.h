@@ -10,11 +10,13 @@
 #include "Clients/Components/Configs/SAPlayerComponentConfig.h"
 #include "Sune/SuneBus.h"
 #include "AzCore/Component/TransformBus.h"
+#include "AzCore/Component/TickBus.h"
 
 namespace TuSteamAudio
 {
     class SAPlayerComponentController
         : protected AZ::TransformNotificationBus::Handler
+        , protected AZ::TickBus::Handler
     {
     public:
         AZ_RTTI(SAPlayerComponentController, "{4346D1F8-8BBF-4E38-843F-F00B1E0068BD}");
@@ -36,7 +38,14 @@ namespace TuSteamAudio
         void OnConfigurationUpdated();
 
         void OnTransformChanged(const AZ::Transform& _, const AZ::Transform& transform) override;
+
+    protected:
+        // TickBus, only connected while transforms are being held back
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
     private:
+        void SendTransform();
+
         friend class EditorSAPlayerComponent;
         friend class SAPlayerComponent;
         AZ::EntityComponentIdPair m_entityComponentIdPair;
@@ -44,5 +53,11 @@ namespace TuSteamAudio
 
         Sune::SoundPlayerId m_playerId;
         Sune::PlayerEffectId m_hrtfId = Sune::PlayerEffectId();
+
+        //The HRTF node interpolates between transforms, so moving entities only send one every m_transformInterval
+        float m_transformInterval = 0.0f;
+        float m_timeSinceTransform = 0.0f;
+        AZ::Transform m_pendingTransform = AZ::Transform::CreateIdentity();
+        bool m_hasPendingTransform = false;
     };
 } // TuSteamAudio
\ No newline at end of file
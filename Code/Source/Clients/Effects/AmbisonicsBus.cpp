@@ -0,0 +1,187 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "AmbisonicsBus.h"
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace TuSteamAudio;
+
+bool AmbisonicsBus::Create(IPLContext context, const IPLAudioSettings& audioSettings, IPLHRTF hrtf, int order)
+{
+    Release();
+
+    m_context = iplContextRetain(context);
+    m_audioSettings = audioSettings;
+    m_order = order;
+
+    m_decodeEffect = CreateDecodeEffect(hrtf);
+    if (!m_decodeEffect)
+    {
+        Release();
+        return false;
+    }
+    m_hrtf = iplHRTFRetain(hrtf);
+    m_gameHrtf = hrtf;
+
+    iplAudioBufferAllocate(m_context, GetNumChannels(order), audioSettings.frameSize, &m_buffer);
+    iplAudioBufferAllocate(m_context, 2, audioSettings.frameSize, &m_fadeBuffer);
+    Clear();
+    return true;
+}
+
+IPLAmbisonicsDecodeEffect AmbisonicsBus::CreateDecodeEffect(IPLHRTF hrtf) const
+{
+    IPLAmbisonicsDecodeEffectSettings decodeSettings{};
+    decodeSettings.maxOrder = m_order;
+    decodeSettings.hrtf = hrtf;
+
+    IPLAmbisonicsDecodeEffect decodeEffect = nullptr;
+    IPLerror err = iplAmbisonicsDecodeEffectCreate(m_context, &m_audioSettings, &decodeSettings, &decodeEffect);
+    if (err != IPL_STATUS_SUCCESS)
+    {
+        AZ_Error("AmbisonicsBus", false, "Failed to create ambisonics decode effect of order %d", m_order);
+        return nullptr;
+    }
+    return decodeEffect;
+}
+
+void AmbisonicsBus::ReleaseDecoder(IPLHRTF& hrtf, IPLAmbisonicsDecodeEffect& decodeEffect)
+{
+    if (decodeEffect)
+    {
+        iplAmbisonicsDecodeEffectRelease(&decodeEffect);
+        decodeEffect = nullptr;
+    }
+
+    if (hrtf)
+    {
+        iplHRTFRelease(&hrtf);
+        hrtf = nullptr;
+    }
+}
+
+void AmbisonicsBus::Release()
+{
+    if (m_buffer.numChannels > 0)
+    {
+        iplAudioBufferFree(m_context, &m_buffer);
+        m_buffer = {};
+    }
+
+    if (m_fadeBuffer.numChannels > 0)
+    {
+        iplAudioBufferFree(m_context, &m_fadeBuffer);
+        m_fadeBuffer = {};
+    }
+
+    ReleaseDecoder(m_hrtf, m_decodeEffect);
+    ReleaseDecoder(m_nextHrtf, m_nextDecodeEffect);
+    ReleaseDecoder(m_fadeHrtf, m_fadeDecodeEffect);
+    m_swapState.store(HrtfSwapState::Idle, AZStd::memory_order_relaxed);
+    m_gameHrtf = nullptr;
+
+    if (m_context)
+    {
+        iplContextRelease(&m_context);
+        m_context = nullptr;
+    }
+
+    m_order = 0;
+}
+
+void AmbisonicsBus::Clear()
+{
+    for (int channel = 0; channel < m_buffer.numChannels; ++channel)
+    {
+        AZStd::fill(m_buffer.data[channel], m_buffer.data[channel] + m_buffer.numSamples, 0.0f);
+    }
+}
+
+void AmbisonicsBus::Accumulate(const IPLAudioBuffer& encoded)
+{
+    const int numChannels = AZStd::min(encoded.numChannels, m_buffer.numChannels);
+    const int numSamples = AZStd::min(encoded.numSamples, m_buffer.numSamples);
+    for (int channel = 0; channel < numChannels; ++channel)
+    {
+        const float* src = encoded.data[channel];
+        float* dst = m_buffer.data[channel];
+        for (int frame = 0; frame < numSamples; ++frame)
+        {
+            dst[frame] += src[frame];
+        }
+    }
+}
+
+void AmbisonicsBus::Decode(const IPLCoordinateSpace3& listener, IPLAudioBuffer& stereoOut)
+{
+    HrtfSwapState offered = HrtfSwapState::Offered;
+    if (m_swapState.compare_exchange_strong(offered, HrtfSwapState::Fading, AZStd::memory_order_acq_rel))
+    {
+        // The game thread keeps its hands off both decoders until this one is Retired
+        m_fadeHrtf = m_hrtf;
+        m_fadeDecodeEffect = m_decodeEffect;
+        m_hrtf = m_nextHrtf;
+        m_decodeEffect = m_nextDecodeEffect;
+        m_nextHrtf = nullptr;
+        m_nextDecodeEffect = nullptr;
+        m_fade.Start(m_audioSettings.frameSize, m_audioSettings.frameSize);
+    }
+
+    IPLAmbisonicsDecodeEffectParams params{};
+    params.order = m_order;
+    params.hrtf = m_hrtf;
+    params.orientation = listener;
+    params.binaural = IPL_TRUE;
+    iplAmbisonicsDecodeEffectApply(m_decodeEffect, &params, &m_buffer, &stereoOut);
+
+    if (m_swapState.load(AZStd::memory_order_relaxed) == HrtfSwapState::Fading)
+    {
+        params.hrtf = m_fadeHrtf;
+        iplAmbisonicsDecodeEffectApply(m_fadeDecodeEffect, &params, &m_buffer, &m_fadeBuffer);
+        m_fade.Apply(m_fadeBuffer, stereoOut);
+        if (m_fade.Advance(stereoOut.numSamples))
+        {
+            m_swapState.store(HrtfSwapState::Retired, AZStd::memory_order_release);
+        }
+    }
+}
+
+void AmbisonicsBus::UpdateHrtf(IPLHRTF hrtf)
+{
+    if (m_swapState.load(AZStd::memory_order_acquire) == HrtfSwapState::Retired)
+    {
+        ReleaseDecoder(m_fadeHrtf, m_fadeDecodeEffect);
+        m_swapState.store(HrtfSwapState::Idle, AZStd::memory_order_release);
+    }
+
+    if (!m_decodeEffect || hrtf == m_gameHrtf)
+    {
+        return;
+    }
+
+    // Not picked up yet, take it back and offer the newer one instead
+    HrtfSwapState offered = HrtfSwapState::Offered;
+    if (m_swapState.compare_exchange_strong(offered, HrtfSwapState::Idle, AZStd::memory_order_acq_rel))
+    {
+        ReleaseDecoder(m_nextHrtf, m_nextDecodeEffect);
+    }
+
+    if (m_swapState.load(AZStd::memory_order_acquire) != HrtfSwapState::Idle)
+    {
+        return;
+    }
+
+    // A decoder that can't be created isn't retried every tick, the bus stays on the HRTF it has
+    m_gameHrtf = hrtf;
+    m_nextDecodeEffect = CreateDecodeEffect(hrtf);
+    if (m_nextDecodeEffect)
+    {
+        m_nextHrtf = iplHRTFRetain(hrtf);
+        m_swapState.store(HrtfSwapState::Offered, AZStd::memory_order_release);
+    }
+}
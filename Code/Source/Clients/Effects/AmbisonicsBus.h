@@ -0,0 +1,68 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "Clients/Hrtf/HrtfSwap.h"
+#include "phonon.h"
+
+#include <AzCore/std/parallel/atomic.h>
+
+namespace TuSteamAudio
+{
+    //! Shared ambisonic mix bus with a single binaural decoder.
+    //! Sources encode into it, the owner decodes it once per quantum for the listener.
+    //! The owner registers it as an HrtfClient, a new HRTF gets a decoder of its own that Decode crossfades to.
+    class AmbisonicsBus
+        : public HrtfClient
+    {
+    public:
+        static int GetNumChannels(int order) { return (order + 1) * (order + 1); }
+
+        bool Create(IPLContext context, const IPLAudioSettings& audioSettings, IPLHRTF hrtf, int order);
+        void Release();
+        bool IsValid() const { return m_decodeEffect != nullptr; }
+
+        int GetOrder() const { return m_order; }
+        int GetNumChannels() const { return GetNumChannels(m_order); }
+
+        //! Render thread, clears the bus at the start of a quantum.
+        void Clear();
+        //! Render thread, sums an encoded ambisonic buffer of this bus' order into the bus.
+        void Accumulate(const IPLAudioBuffer& encoded);
+        //! Render thread, for producers that write the whole bus in one go instead of accumulating.
+        IPLAudioBuffer& GetBuffer() { return m_buffer; }
+        //! Render thread, decodes the bus binaurally into a stereo buffer.
+        void Decode(const IPLCoordinateSpace3& listener, IPLAudioBuffer& stereoOut);
+
+        // HrtfClient
+        void UpdateHrtf(IPLHRTF hrtf) override;
+
+    private:
+        IPLAmbisonicsDecodeEffect CreateDecodeEffect(IPLHRTF hrtf) const;
+        //! Game thread, releases the decoder faded away from or an offer that was withdrawn.
+        static void ReleaseDecoder(IPLHRTF& hrtf, IPLAmbisonicsDecodeEffect& decodeEffect);
+
+        IPLContext m_context = nullptr;
+        IPLAudioSettings m_audioSettings = {};
+        //Render thread once created, the decoder in use
+        IPLHRTF m_hrtf = nullptr;
+        IPLAmbisonicsDecodeEffect m_decodeEffect = nullptr;
+        IPLAudioBuffer m_buffer = {};
+        int m_order = 0;
+
+        //HRTF swap, next is written by the game thread while Idle, fade released by it once Retired
+        AZStd::atomic<HrtfSwapState> m_swapState{ HrtfSwapState::Idle };
+        //! Game thread, the HRTF last offered. Only compared, never dereferenced.
+        IPLHRTF m_gameHrtf = nullptr;
+        IPLHRTF m_nextHrtf = nullptr;
+        IPLAmbisonicsDecodeEffect m_nextDecodeEffect = nullptr;
+        IPLHRTF m_fadeHrtf = nullptr;
+        IPLAmbisonicsDecodeEffect m_fadeDecodeEffect = nullptr;
+        IPLAudioBuffer m_fadeBuffer = {};
+        HrtfCrossfade m_fade;
+    };
+} // TuSteamAudio
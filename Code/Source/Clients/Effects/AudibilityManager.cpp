@@ -0,0 +1,179 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "AudibilityManager.h"
+
+#include <LabSound/core/AudioContext.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/sort.h>
+
+using namespace TuSteamAudio;
+
+namespace
+{
+    // Weight of the newest Full cost report, smooths over the odd slow quantum
+    constexpr double FullCostSmoothing = 0.05;
+}
+
+AudibilityManager::AudibilityManager()
+{
+    for (AZ::u32 i = 0; i < MaxVoices; ++i)
+    {
+        m_inUse[i].store(false, AZStd::memory_order_relaxed);
+        m_audibility[i].store(1.0f, AZStd::memory_order_relaxed);
+        m_tier[i].store(AudibilityTier::Full, AZStd::memory_order_relaxed);
+    }
+    for (AZStd::atomic<AZ::u32>& count : m_tierCounts)
+    {
+        count.store(0, AZStd::memory_order_relaxed);
+    }
+    m_settings.Write(m_renderSettings);
+}
+
+AudibilitySettings AudibilityManager::GetSettings() const
+{
+    AudibilitySettings settings;
+    m_settings.Read(settings);
+    return settings;
+}
+
+AudibilityVoiceId AudibilityManager::Register()
+{
+    for (AZ::u32 i = 0; i < MaxVoices; ++i)
+    {
+        bool expected = false;
+        if (m_inUse[i].compare_exchange_strong(expected, true, AZStd::memory_order_acq_rel))
+        {
+            AZ::u32 highWater = m_highWater.load(AZStd::memory_order_relaxed);
+            while (highWater <= i && !m_highWater.compare_exchange_weak(highWater, i + 1, AZStd::memory_order_release))
+            {
+            }
+            return static_cast<AudibilityVoiceId>(i);
+        }
+    }
+
+    AZ_Error("AudibilityManager", false, "Out of voice slots (%u), the voice always renders at Full", MaxVoices);
+    return InvalidAudibilityVoiceId;
+}
+
+void AudibilityManager::Unregister(AudibilityVoiceId id)
+{
+    if (id < 0 || static_cast<AZ::u32>(id) >= MaxVoices)
+    {
+        return;
+    }
+
+    // Free slots hold the defaults, the next voice to take it starts out audible
+    m_audibility[id].store(1.0f, AZStd::memory_order_relaxed);
+    m_tier[id].store(AudibilityTier::Full, AZStd::memory_order_relaxed);
+    m_inUse[id].store(false, AZStd::memory_order_release);
+}
+
+AudibilityTier AudibilityManager::Update(lab::ContextRenderLock& r, AudibilityVoiceId id, float audibility)
+{
+    if (id < 0 || static_cast<AZ::u32>(id) >= MaxVoices)
+    {
+        return AudibilityTier::Full;
+    }
+
+    const AZ::u64 frame = r.context()->currentSampleFrame();
+    if (frame != m_rankedFrame)
+    {
+        m_rankedFrame = frame;
+        Rank();
+    }
+
+    m_audibility[id].store(audibility, AZStd::memory_order_relaxed);
+    return m_tier[id].load(AZStd::memory_order_relaxed);
+}
+
+void AudibilityManager::ReportFullCost(double seconds)
+{
+    // Smoothed from the first report on, a cold first quantum only nudges the estimate
+    const double cost = m_fullCost.load(AZStd::memory_order_relaxed);
+    m_fullCost.store(cost + (seconds - cost) * FullCostSmoothing, AZStd::memory_order_relaxed);
+}
+
+AudibilityTier AudibilityManager::GetTier(AudibilityVoiceId id) const
+{
+    if (id < 0 || static_cast<AZ::u32>(id) >= MaxVoices)
+    {
+        return AudibilityTier::Full;
+    }
+    return m_tier[id].load(AZStd::memory_order_relaxed);
+}
+
+void AudibilityManager::Rank()
+{
+    AZ_PROFILE_FUNCTION(Audio);
+
+    // Keeps the previous settings if the game thread is mid write
+    m_settings.Read(m_renderSettings);
+
+    // Snapshot first, the sort needs values that hold still
+    AZ::u32 count = 0;
+    const AZ::u32 highWater = m_highWater.load(AZStd::memory_order_acquire);
+    for (AZ::u32 i = 0; i < highWater; ++i)
+    {
+        if (m_inUse[i].load(AZStd::memory_order_acquire))
+        {
+            m_rankAudibility[i] = m_audibility[i].load(AZStd::memory_order_relaxed);
+            m_order[count++] = static_cast<AZ::u16>(i);
+        }
+    }
+
+    AZStd::array<AZ::u32, TierCount> tierCounts = {};
+    if (!m_renderSettings.m_enabled)
+    {
+        for (AZ::u32 k = 0; k < count; ++k)
+        {
+            m_tier[m_order[k]].store(AudibilityTier::Full, AZStd::memory_order_relaxed);
+        }
+        tierCounts[static_cast<int>(AudibilityTier::Full)] = count;
+    }
+    else
+    {
+        AZStd::sort(m_order.begin(), m_order.begin() + count, [this](AZ::u16 a, AZ::u16 b)
+        {
+            return m_rankAudibility[a] > m_rankAudibility[b];
+        });
+
+        // As many Full voices as the budget pays for at the measured cost, before any were measured the cap decides.
+        // Only Full voices report their cost, so one is always allowed whatever it costs or the estimate would never recover
+        AZ::u32 fullVoices = m_renderSettings.m_maxFullVoices;
+        const double fullCost = m_fullCost.load(AZStd::memory_order_relaxed);
+        if (fullCost > 0.0 && fullVoices > 0)
+        {
+            const double affordable = AZStd::min((m_renderSettings.m_cpuBudgetMs * 0.001) / fullCost, static_cast<double>(fullVoices));
+            fullVoices = AZStd::max(1u, static_cast<AZ::u32>(affordable));
+        }
+
+        for (AZ::u32 k = 0; k < count; ++k)
+        {
+            const AZ::u16 voice = m_order[k];
+            const float audibility = m_rankAudibility[voice];
+
+            AudibilityTier tier = AudibilityTier::Panning;
+            if (audibility < m_renderSettings.m_virtualThreshold)
+            {
+                tier = AudibilityTier::Virtual;
+            }
+            else if (k < fullVoices && audibility >= m_renderSettings.m_panningThreshold)
+            {
+                tier = AudibilityTier::Full;
+            }
+
+            m_tier[voice].store(tier, AZStd::memory_order_relaxed);
+            ++tierCounts[static_cast<int>(tier)];
+        }
+    }
+
+    for (int tier = 0; tier < TierCount; ++tier)
+    {
+        m_tierCounts[tier].store(tierCounts[tier], AZStd::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,112 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "Clients/Simulation/SimulationOutputBuffer.h"
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace lab
+{
+    class ContextRenderLock;
+}
+
+namespace TuSteamAudio
+{
+    //! How much of the spatializer a voice gets, cheapest first.
+    enum class AudibilityTier : AZ::u8
+    {
+        //! No DSP and no simulation, the input is still pulled so playback keeps its position.
+        Virtual,
+        //! Direct effect and a constant power pan. Never handed out by the ranking, only the
+        //! global quality caps voices down to it.
+        StereoPan,
+        //! Direct effect and a stereo pan, no HRTF and no reflections.
+        Panning,
+        //! Direct effect, HRTF and reflections.
+        Full
+    };
+
+    struct AudibilitySettings
+    {
+        //! Off renders every voice at Full.
+        bool m_enabled = true;
+        //! Voices quieter than this go virtual, -60 dB.
+        float m_virtualThreshold = 0.001f;
+        //! Voices quieter than this pan even when the budget has room for them, -40 dB.
+        float m_panningThreshold = 0.01f;
+        //! Upper bound on Full voices, whatever the budget.
+        AZ::u32 m_maxFullVoices = 32;
+        //! Render thread time per quantum the listener's Full voices may take, in milliseconds.
+        //! The loudest voice stays Full even when it alone goes over, it keeps the cost measured.
+        float m_cpuBudgetMs = 2.0f;
+        //! Length of the crossfade when a voice changes tier, in seconds.
+        float m_crossfadeTime = 0.05f;
+    };
+
+    using AudibilityVoiceId = AZ::s32;
+    constexpr AudibilityVoiceId InvalidAudibilityVoiceId = -1;
+
+    //! Ranks every voice heard by the listener once per render quantum and hands out tiers.
+    //! The loudest voices get Full until the measured cost of a Full voice uses up the CPU budget,
+    //! the rest pan, and anything below the virtual threshold is not rendered at all.
+    //! LabSound has a single listener, so there is one of these next to the ListenerCache.
+    class AudibilityManager
+    {
+    public:
+        static constexpr AZ::u32 MaxVoices = 1024;
+        static constexpr int TierCount = 4;
+
+        AudibilityManager();
+
+        //! Game thread, picked up by the next ranking.
+        void SetSettings(const AudibilitySettings& settings) { m_settings.Write(settings); }
+        AudibilitySettings GetSettings() const;
+
+        //! Game thread.
+        AudibilityVoiceId Register();
+        void Unregister(AudibilityVoiceId id);
+
+        //! Render thread. Reports how loud the voice is this quantum, 0 to 1 after distance and occlusion,
+        //! and returns the tier it should render at. The first voice to ask in a quantum ranks everyone on
+        //! what they reported last quantum.
+        AudibilityTier Update(lab::ContextRenderLock& r, AudibilityVoiceId id, float audibility);
+        //! Render thread, the settings the last ranking used.
+        const AudibilitySettings& GetRenderSettings() const { return m_renderSettings; }
+        //! Render thread. Time a Full voice spent rendering one quantum, feeds the budget.
+        void ReportFullCost(double seconds);
+
+        //! Any thread, as of the last ranking.
+        AudibilityTier GetTier(AudibilityVoiceId id) const;
+        AZ::u32 GetTierCount(AudibilityTier tier) const { return m_tierCounts[static_cast<int>(tier)].load(AZStd::memory_order_relaxed); }
+        //! Average render thread seconds a Full voice costs per quantum, 0 until one reported.
+        double GetFullCost() const { return m_fullCost.load(AZStd::memory_order_relaxed); }
+
+    private:
+        void Rank();
+
+        SimulationOutputBuffer<AudibilitySettings> m_settings;
+        //Render thread copy, refreshed on every ranking
+        AudibilitySettings m_renderSettings;
+        AZ::u64 m_rankedFrame = ~AZ::u64(0);
+
+        AZStd::array<AZStd::atomic_bool, MaxVoices> m_inUse;
+        AZStd::array<AZStd::atomic<float>, MaxVoices> m_audibility;
+        AZStd::array<AZStd::atomic<AudibilityTier>, MaxVoices> m_tier;
+        //One past the highest slot ever used, bounds the ranking
+        AZStd::atomic<AZ::u32> m_highWater{ 0 };
+
+        //Render thread scratch, audibility as it was when the ranking started and the voices ordered by it
+        AZStd::array<float, MaxVoices> m_rankAudibility;
+        AZStd::array<AZ::u16, MaxVoices> m_order;
+
+        AZStd::array<AZStd::atomic<AZ::u32>, TierCount> m_tierCounts;
+        AZStd::atomic<double> m_fullCost{ 0.0 };
+    };
+} // TuSteamAudio
@@ -0,0 +1,143 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "DirectPathKernel.h"
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Simd/SimdMath.h>
+#include <cmath>
+
+using namespace TuSteamAudio;
+
+namespace
+{
+    using Vec4 = AZ::Simd::Vec4;
+
+    // Below this a source sits on the listener, its direction comes out as zero like Steam Audio's
+    constexpr float MinDirectionLength = 1.0e-6f;
+    // exp(-80) is far below anything audible, larger exponents only cost precision in the reduction
+    constexpr float MaxAbsorptionExponent = 80.0f;
+
+    // exp(-y) for y >= 0. The argument is cut down by 32 so a degree 8 Taylor polynomial is accurate
+    // to 1e-7, then squared back up five times. Rounding in the squaring dominates, 6e-6 relative up to y = 20.
+    Vec4::FloatType ExpNegative(Vec4::FloatArgType y)
+    {
+        const Vec4::FloatType t = Vec4::Mul(Vec4::Min(y, Vec4::Splat(MaxAbsorptionExponent)), Vec4::Splat(1.0f / 32.0f));
+
+        // Horner form of sum (-t)^k / k!, k = 0..8
+        Vec4::FloatType p = Vec4::Splat(1.0f / 40320.0f);
+        p = Vec4::Madd(p, t, Vec4::Splat(-1.0f / 5040.0f));
+        p = Vec4::Madd(p, t, Vec4::Splat(1.0f / 720.0f));
+        p = Vec4::Madd(p, t, Vec4::Splat(-1.0f / 120.0f));
+        p = Vec4::Madd(p, t, Vec4::Splat(1.0f / 24.0f));
+        p = Vec4::Madd(p, t, Vec4::Splat(-1.0f / 6.0f));
+        p = Vec4::Madd(p, t, Vec4::Splat(1.0f / 2.0f));
+        p = Vec4::Madd(p, t, Vec4::Splat(-1.0f));
+        p = Vec4::Madd(p, t, Vec4::Splat(1.0f));
+        p = Vec4::Max(p, Vec4::ZeroFloat());
+
+        for (int i = 0; i < 5; ++i)
+        {
+            p = Vec4::Mul(p, p);
+        }
+        return p;
+    }
+}
+
+void DirectPathResults::Resize(AZ::u32 count)
+{
+    m_directionX.resize(count, 0.0f);
+    m_directionY.resize(count, 0.0f);
+    m_directionZ.resize(count, 0.0f);
+    m_distance.resize(count, 0.0f);
+    m_distanceAttenuation.resize(count, 1.0f);
+    for (AZStd::vector<float>& band : m_airAbsorption)
+    {
+        band.resize(count, 1.0f);
+    }
+}
+
+void TuSteamAudio::CalculateDirectPaths(const IPLCoordinateSpace3& listener, const DirectPathSources& sources,
+    const float* airAbsorptionCoefficients, DirectPathResults& results)
+{
+    AZ_Assert(results.m_distance.size() >= sources.m_count, "DirectPathResults is too small for the batch");
+
+    const Vec4::FloatType listenerX = Vec4::Splat(listener.origin.x);
+    const Vec4::FloatType listenerY = Vec4::Splat(listener.origin.y);
+    const Vec4::FloatType listenerZ = Vec4::Splat(listener.origin.z);
+    const Vec4::FloatType rightX = Vec4::Splat(listener.right.x);
+    const Vec4::FloatType rightY = Vec4::Splat(listener.right.y);
+    const Vec4::FloatType rightZ = Vec4::Splat(listener.right.z);
+    const Vec4::FloatType upX = Vec4::Splat(listener.up.x);
+    const Vec4::FloatType upY = Vec4::Splat(listener.up.y);
+    const Vec4::FloatType upZ = Vec4::Splat(listener.up.z);
+    // Steam Audio's listener space looks down -Z
+    const Vec4::FloatType backX = Vec4::Splat(-listener.ahead.x);
+    const Vec4::FloatType backY = Vec4::Splat(-listener.ahead.y);
+    const Vec4::FloatType backZ = Vec4::Splat(-listener.ahead.z);
+    const Vec4::FloatType one = Vec4::Splat(1.0f);
+    const Vec4::FloatType minLength = Vec4::Splat(MinDirectionLength);
+    const Vec4::FloatType coefficients[3] = {
+        Vec4::Splat(airAbsorptionCoefficients[0]),
+        Vec4::Splat(airAbsorptionCoefficients[1]),
+        Vec4::Splat(airAbsorptionCoefficients[2])
+    };
+
+    const AZ::u32 vectorCount = sources.m_count & ~3u;
+    for (AZ::u32 i = 0; i < vectorCount; i += 4)
+    {
+        const Vec4::FloatType dx = Vec4::Sub(Vec4::LoadUnaligned(sources.m_positionX + i), listenerX);
+        const Vec4::FloatType dy = Vec4::Sub(Vec4::LoadUnaligned(sources.m_positionY + i), listenerY);
+        const Vec4::FloatType dz = Vec4::Sub(Vec4::LoadUnaligned(sources.m_positionZ + i), listenerZ);
+
+        const Vec4::FloatType distance = Vec4::Sqrt(Vec4::Madd(dx, dx, Vec4::Madd(dy, dy, Vec4::Mul(dz, dz))));
+        const Vec4::FloatType invLength = Vec4::Div(one, Vec4::Max(distance, minLength));
+
+        // Project onto the listener basis, then normalize
+        const Vec4::FloatType localX = Vec4::Madd(dx, rightX, Vec4::Madd(dy, rightY, Vec4::Mul(dz, rightZ)));
+        const Vec4::FloatType localY = Vec4::Madd(dx, upX, Vec4::Madd(dy, upY, Vec4::Mul(dz, upZ)));
+        const Vec4::FloatType localZ = Vec4::Madd(dx, backX, Vec4::Madd(dy, backY, Vec4::Mul(dz, backZ)));
+        Vec4::StoreUnaligned(results.m_directionX.data() + i, Vec4::Mul(localX, invLength));
+        Vec4::StoreUnaligned(results.m_directionY.data() + i, Vec4::Mul(localY, invLength));
+        Vec4::StoreUnaligned(results.m_directionZ.data() + i, Vec4::Mul(localZ, invLength));
+        Vec4::StoreUnaligned(results.m_distance.data() + i, distance);
+
+        const Vec4::FloatType minDistance = Vec4::LoadUnaligned(sources.m_minDistance + i);
+        Vec4::StoreUnaligned(results.m_distanceAttenuation.data() + i, Vec4::Div(one, Vec4::Max(distance, minDistance)));
+
+        for (int band = 0; band < 3; ++band)
+        {
+            Vec4::StoreUnaligned(results.m_airAbsorption[band].data() + i, ExpNegative(Vec4::Mul(coefficients[band], distance)));
+        }
+    }
+
+    CalculateDirectPathsScalar(listener, sources, airAbsorptionCoefficients, results, vectorCount);
+}
+
+void TuSteamAudio::CalculateDirectPathsScalar(const IPLCoordinateSpace3& listener, const DirectPathSources& sources,
+    const float* airAbsorptionCoefficients, DirectPathResults& results, AZ::u32 first)
+{
+    for (AZ::u32 i = first; i < sources.m_count; ++i)
+    {
+        const float dx = sources.m_positionX[i] - listener.origin.x;
+        const float dy = sources.m_positionY[i] - listener.origin.y;
+        const float dz = sources.m_positionZ[i] - listener.origin.z;
+
+        const float distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+        const float invLength = 1.0f / AZ::GetMax(distance, MinDirectionLength);
+
+        results.m_directionX[i] = (dx * listener.right.x + dy * listener.right.y + dz * listener.right.z) * invLength;
+        results.m_directionY[i] = (dx * listener.up.x + dy * listener.up.y + dz * listener.up.z) * invLength;
+        results.m_directionZ[i] = -(dx * listener.ahead.x + dy * listener.ahead.y + dz * listener.ahead.z) * invLength;
+        results.m_distance[i] = distance;
+        results.m_distanceAttenuation[i] = 1.0f / AZ::GetMax(distance, sources.m_minDistance[i]);
+
+        for (int band = 0; band < 3; ++band)
+        {
+            results.m_airAbsorption[band][i] = std::exp(-airAbsorptionCoefficients[band] * distance);
+        }
+    }
+}
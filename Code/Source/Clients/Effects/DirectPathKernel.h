@@ -0,0 +1,57 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "phonon.h"
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace TuSteamAudio
+{
+    //! Steam Audio's IPL_AIRABSORPTIONTYPE_DEFAULT coefficients, per metre for the low, mid and high band.
+    static constexpr float DefaultAirAbsorptionCoefficients[3] = { 0.0002f, 0.0017f, 0.0182f };
+
+    //! Batch of sources, structure of arrays in the same space as the listener. Every array holds count values.
+    struct DirectPathSources
+    {
+        const float* m_positionX = nullptr;
+        const float* m_positionY = nullptr;
+        const float* m_positionZ = nullptr;
+        //! Inverse distance clamp, 1 for Steam Audio's default model.
+        const float* m_minDistance = nullptr;
+        AZ::u32 m_count = 0;
+    };
+
+    //! Per source results, structure of arrays. Sized once so the render thread never allocates.
+    struct DirectPathResults
+    {
+        void Resize(AZ::u32 count);
+
+        //! Listener relative unit direction, what iplCalculateRelativeDirection returns.
+        AZStd::vector<float> m_directionX;
+        AZStd::vector<float> m_directionY;
+        AZStd::vector<float> m_directionZ;
+        AZStd::vector<float> m_distance;
+        //! Inverse distance gain, what iplDistanceAttenuationCalculate returns for the default and inverse models.
+        //! Sources on a TuAttenuation curve look their gain up from m_distance instead.
+        AZStd::vector<float> m_distanceAttenuation;
+        AZStd::array<AZStd::vector<float>, 3> m_airAbsorption;
+    };
+
+    //! Direction, distance, inverse distance gain and 3 band exponential air absorption for every source at once.
+    //! Four sources per iteration through AZ::Simd, which picks SSE or NEON and falls back to scalar code itself,
+    //! the remainder runs the scalar version. Air absorption uses a polynomial exp that stays within 1e-5 of
+    //! std::exp relative to the result for anything audible.
+    void CalculateDirectPaths(const IPLCoordinateSpace3& listener, const DirectPathSources& sources,
+        const float* airAbsorptionCoefficients, DirectPathResults& results);
+
+    //! One source at a time with the C library, what the batched version is checked and benchmarked against.
+    void CalculateDirectPathsScalar(const IPLCoordinateSpace3& listener, const DirectPathSources& sources,
+        const float* airAbsorptionCoefficients, DirectPathResults& results, AZ::u32 first = 0);
+} // TuSteamAudio
@@ -0,0 +1,52 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "ListenerCache.h"
+
+#include <LabSound/core/AudioContext.h>
+#include <LabSound/core/AudioListener.h>
+#include <TuSteamAudio/Utils.h>
+
+using namespace TuSteamAudio;
+
+static bool SameVector(const IPLVector3& a, const IPLVector3& b)
+{
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+const ListenerState& ListenerCache::Capture(lab::ContextRenderLock& r)
+{
+    lab::AudioContext* context = r.context();
+    const AZ::u64 frame = context->currentSampleFrame();
+    if (frame == m_capturedFrame)
+    {
+        return m_state;
+    }
+    m_capturedFrame = frame;
+
+    auto listener = context->listener();
+    const IPLVector3 origin = { listener->positionX()->value(), listener->positionY()->value(), listener->positionZ()->value() };
+    const IPLVector3 ahead = { listener->forwardX()->value(), listener->forwardY()->value(), listener->forwardZ()->value() };
+    const IPLVector3 up = { listener->upX()->value(), listener->upY()->value(), listener->upZ()->value() };
+
+    IPLCoordinateSpace3& coords = m_state.m_coords;
+    const bool moved = m_state.m_generation == 0 ||
+        !SameVector(coords.origin, origin) || !SameVector(coords.ahead, ahead) || !SameVector(coords.up, up);
+    if (!moved)
+    {
+        return m_state;
+    }
+
+    coords.origin = origin;
+    coords.ahead = ahead;
+    coords.up = up;
+    coords.right = ComputeRightVector(ahead, up);
+    ++m_state.m_generation;
+    m_state.m_movedTime = context->currentTime();
+
+    m_published.Write(m_state);
+    return m_state;
+}
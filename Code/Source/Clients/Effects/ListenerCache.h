@@ -0,0 +1,49 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "phonon.h"
+#include "Clients/Simulation/SimulationOutputBuffer.h"
+
+#include <AzCore/base.h>
+
+namespace lab
+{
+    class ContextRenderLock;
+}
+
+namespace TuSteamAudio
+{
+    //! The LabSound listener as it was at the start of one render quantum, already in Steam Audio's layout.
+    struct ListenerState
+    {
+        //! origin, ahead and up straight from LabSound, right precomputed with ComputeRightVector.
+        IPLCoordinateSpace3 m_coords = { {1.0f, 0.0f, 0.0f}, {0.0f, 1.0f, 0.0f}, {0.0f, 0.0f, -1.0f}, {0.0f, 0.0f, 0.0f} };
+        //! Bumped whenever the captured listener differs from the previous capture, never on an idle quantum.
+        AZ::u64 m_generation = 0;
+        //! Context time of the quantum the listener last moved on, in seconds.
+        double m_movedTime = 0.0;
+    };
+
+    //! Reads the nine listener params once per render quantum for every node that needs them.
+    //! The first node to ask in a quantum captures, the rest get the same snapshot. Other threads
+    //! read the last published capture instead of touching the LabSound params themselves.
+    class ListenerCache
+    {
+    public:
+        //! Render thread only.
+        const ListenerState& Capture(lab::ContextRenderLock& r);
+
+        //! Any thread. False until the render thread captured once.
+        bool Read(ListenerState& out) const { return m_published.Read(out); }
+
+    private:
+        ListenerState m_state;
+        AZ::u64 m_capturedFrame = ~AZ::u64(0);
+        SimulationOutputBuffer<ListenerState> m_published;
+    };
+} // TuSteamAudio
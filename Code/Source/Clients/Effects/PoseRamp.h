@@ -0,0 +1,104 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/Vector3.h>
+
+namespace TuSteamAudio
+{
+    //! Listener position and orientation, in the same space as the LabSound listener.
+    struct ListenerPose
+    {
+        AZ::Vector3 m_position = AZ::Vector3::CreateZero();
+        AZ::Vector3 m_forward = AZ::Vector3(0.0f, 0.0f, -1.0f);
+        AZ::Vector3 m_up = AZ::Vector3(0.0f, 1.0f, 0.0f);
+    };
+
+    inline AZ::Vector3 LerpPose(const AZ::Vector3& from, const AZ::Vector3& to, float t)
+    {
+        return from.Lerp(to, t);
+    }
+
+    inline ListenerPose LerpPose(const ListenerPose& from, const ListenerPose& to, float t)
+    {
+        ListenerPose pose;
+        pose.m_position = from.m_position.Lerp(to.m_position, t);
+        pose.m_forward = from.m_forward.Lerp(to.m_forward, t).GetNormalizedSafe();
+        pose.m_up = from.m_up.Lerp(to.m_up, t).GetNormalizedSafe();
+        return pose;
+    }
+
+    //! Render thread side of a pose that is updated at a lower rate than it is heard.
+    //! Each update starts a ramp from wherever the last one got to, lasting as long as the gap
+    //! between the last two updates, so a steady update rate plays back as continuous motion.
+    template<typename Pose>
+    class PoseRamp
+    {
+    public:
+        //! Updates further apart than this are treated as a pause and don't slow the ramp down.
+        static constexpr double MaxInterval = 0.1;
+
+        //! timestamp is in seconds, any clock works as long as it is the same for every call.
+        void Push(const Pose& pose, double timestamp)
+        {
+            if (!m_hasPose)
+            {
+                m_from = pose;
+                m_duration = 0.0f;
+            }
+            else
+            {
+                m_from = Evaluate(0.0f);
+                m_duration = static_cast<float>(AZ::GetClamp(timestamp - m_timestamp, 0.0, MaxInterval));
+            }
+
+            m_to = pose;
+            m_elapsed = 0.0f;
+            m_timestamp = timestamp;
+            m_hasPose = true;
+        }
+
+        //! Pose at offset seconds into the quantum about to be rendered.
+        Pose Evaluate(float offset) const
+        {
+            if (m_duration <= 0.0f)
+            {
+                return m_to;
+            }
+            return LerpPose(m_from, m_to, AZ::GetClamp((m_elapsed + offset) / m_duration, 0.0f, 1.0f));
+        }
+
+        //! Call once the quantum was rendered.
+        void Advance(float seconds)
+        {
+            m_elapsed += seconds;
+        }
+
+        //! The next update jumps instead of ramping.
+        void Reset()
+        {
+            m_hasPose = false;
+            m_duration = 0.0f;
+            m_elapsed = 0.0f;
+        }
+
+        //! True once the ramp reached its target, Evaluate then returns the same pose for any offset.
+        bool IsSettled() const { return m_elapsed >= m_duration; }
+
+        bool HasPose() const { return m_hasPose; }
+        const Pose& GetTarget() const { return m_to; }
+
+    private:
+        Pose m_from = {};
+        Pose m_to = {};
+        float m_elapsed = 0.0f;
+        float m_duration = 0.0f;
+        double m_timestamp = 0.0;
+        bool m_hasPose = false;
+    };
+} // TuSteamAudio
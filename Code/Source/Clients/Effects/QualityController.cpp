@@ -0,0 +1,99 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "QualityController.h"
+
+#include <LabSound/core/AudioContext.h>
+
+using namespace TuSteamAudio;
+
+namespace
+{
+    // Weight of the newest quantum in the load average, a single slow quantum shouldn't count as over budget
+    constexpr float LoadSmoothing = 0.1f;
+}
+
+QualityController::QualityController()
+{
+    m_settings.Write(m_renderSettings);
+}
+
+void QualityController::SetSettings(const QualitySettings& settings)
+{
+    m_settings.Write(settings);
+    m_quality.store(settings.m_quality, AZStd::memory_order_relaxed);
+}
+
+QualitySettings QualityController::GetSettings() const
+{
+    QualitySettings settings;
+    m_settings.Read(settings);
+    return settings;
+}
+
+void QualityController::ReportRenderTime(lab::ContextRenderLock& r, double seconds)
+{
+    lab::AudioContext* context = r.context();
+    const AZ::u64 frame = context->currentSampleFrame();
+    if (frame != m_frame)
+    {
+        // Every node of the previous quantum has reported by now
+        if (m_frame != ~AZ::u64(0) && frame > m_frame)
+        {
+            Evaluate(static_cast<double>(frame - m_frame) / context->sampleRate());
+        }
+        m_frame = frame;
+        m_quantumRenderTime = 0.0;
+    }
+    m_quantumRenderTime += seconds;
+}
+
+void QualityController::Evaluate(double quantumSeconds)
+{
+    // Keeps the previous settings if the game thread is mid write
+    m_settings.Read(m_renderSettings);
+
+    const float quantumLoad = static_cast<float>(m_quantumRenderTime / quantumSeconds);
+    const float previousLoad = m_load.load(AZStd::memory_order_relaxed);
+    const float load = previousLoad + (quantumLoad - previousLoad) * LoadSmoothing;
+    m_load.store(load, AZStd::memory_order_relaxed);
+
+    if (!m_renderSettings.m_automatic)
+    {
+        m_overBudgetTime = 0.0;
+        m_underBudgetTime = 0.0;
+        return;
+    }
+
+    // Between the two thresholds nothing moves, that gap is what keeps the quality from oscillating
+    if (load > m_renderSettings.m_budget)
+    {
+        m_overBudgetTime += quantumSeconds;
+        m_underBudgetTime = 0.0;
+    }
+    else if (load < m_renderSettings.m_budget * m_renderSettings.m_upgradeHeadroom)
+    {
+        m_underBudgetTime += quantumSeconds;
+        m_overBudgetTime = 0.0;
+    }
+    else
+    {
+        m_overBudgetTime = 0.0;
+        m_underBudgetTime = 0.0;
+    }
+
+    const SpatialQuality quality = m_quality.load(AZStd::memory_order_relaxed);
+    if (m_overBudgetTime >= m_renderSettings.m_downgradeTime && quality != SpatialQuality::StereoPan)
+    {
+        m_quality.store(static_cast<SpatialQuality>(static_cast<AZ::u8>(quality) + 1), AZStd::memory_order_relaxed);
+        m_overBudgetTime = 0.0;
+    }
+    else if (m_underBudgetTime >= m_renderSettings.m_upgradeTime && quality != SpatialQuality::Bilinear)
+    {
+        m_quality.store(static_cast<SpatialQuality>(static_cast<AZ::u8>(quality) - 1), AZStd::memory_order_relaxed);
+        m_underBudgetTime = 0.0;
+    }
+}
@@ -0,0 +1,109 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "Clients/Simulation/SimulationOutputBuffer.h"
+
+#include <AzCore/base.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace lab
+{
+    class ContextRenderLock;
+}
+
+namespace TuSteamAudio
+{
+    //! Global spatialization quality, best first. Each step down is cheaper than the one before.
+    enum class SpatialQuality : AZ::u8
+    {
+        //! HRTF with whatever interpolation each source asked for.
+        Bilinear,
+        //! HRTF with IPL_HRTFINTERPOLATION_NEAREST for every source.
+        Nearest,
+        //! Steam Audio's panning effect, no HRTF and no reflections.
+        Panning,
+        //! Constant power left/right pan, no Steam Audio effect past the direct one.
+        StereoPan
+    };
+
+    struct QualitySettings
+    {
+        //! Off holds m_quality whatever the render thread costs.
+        bool m_automatic = true;
+        //! Where automatic switching starts, and the fixed quality when it is off.
+        SpatialQuality m_quality = SpatialQuality::Bilinear;
+        //! Share of each quantum's duration the spatializers may spend rendering it.
+        float m_budget = 0.4f;
+        //! Seconds over budget before dropping a step.
+        float m_downgradeTime = 0.25f;
+        //! Seconds under m_upgradeHeadroom * budget before climbing back a step. Much longer than the
+        //! downgrade so a machine sitting right at the budget doesn't flip every other quantum.
+        float m_upgradeTime = 3.0f;
+        float m_upgradeHeadroom = 0.6f;
+    };
+
+    //! Measures how long the spatializers take per render quantum and steps the global quality down when
+    //! they go over the budget, back up once there is room again.
+    class QualityController
+    {
+    public:
+        //! Times one node's process() and reports it when it goes out of scope.
+        class RenderTimer
+        {
+        public:
+            RenderTimer(QualityController* controller, lab::ContextRenderLock& r)
+                : m_controller(controller)
+                , m_lock(r)
+                , m_start(AZStd::chrono::steady_clock::now())
+            {
+            }
+
+            ~RenderTimer()
+            {
+                if (m_controller)
+                {
+                    m_controller->ReportRenderTime(m_lock, AZStd::chrono::duration<double>(AZStd::chrono::steady_clock::now() - m_start).count());
+                }
+            }
+
+        private:
+            QualityController* m_controller;
+            lab::ContextRenderLock& m_lock;
+            AZStd::chrono::steady_clock::time_point m_start;
+        };
+
+        QualityController();
+
+        //! Game thread. A new m_quality takes over right away, automatic switching carries on from it.
+        void SetSettings(const QualitySettings& settings);
+        QualitySettings GetSettings() const;
+
+        //! Any thread.
+        SpatialQuality GetQuality() const { return m_quality.load(AZStd::memory_order_relaxed); }
+        //! Render time of the last quantum as a share of its duration, smoothed.
+        float GetLoad() const { return m_load.load(AZStd::memory_order_relaxed); }
+
+        //! Render thread. Adds to this quantum's total, the first report of the next quantum evaluates it.
+        void ReportRenderTime(lab::ContextRenderLock& r, double seconds);
+
+    private:
+        void Evaluate(double quantumSeconds);
+
+        SimulationOutputBuffer<QualitySettings> m_settings;
+        AZStd::atomic<SpatialQuality> m_quality{ SpatialQuality::Bilinear };
+        AZStd::atomic<float> m_load{ 0.0f };
+
+        //Render thread
+        QualitySettings m_renderSettings;
+        AZ::u64 m_frame = ~AZ::u64(0);
+        double m_quantumRenderTime = 0.0;
+        double m_overBudgetTime = 0.0;
+        double m_underBudgetTime = 0.0;
+    };
+} // TuSteamAudio
@@ -0,0 +1,207 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace TuSteamAudio
+{
+    //! Planar sample FIFO with a fixed capacity. Sized on the game thread, the render thread only copies.
+    class ReblockingFifo
+    {
+    public:
+        //! Game thread.
+        void Allocate(int numChannels, int capacity)
+        {
+            m_numChannels = numChannels;
+            m_capacity = capacity;
+            m_samples.assign(static_cast<size_t>(numChannels) * capacity, 0.0f);
+            Clear();
+        }
+
+        int GetNumChannels() const { return m_numChannels; }
+        int GetSize() const { return m_end - m_begin; }
+        void Clear()
+        {
+            m_begin = 0;
+            m_end = 0;
+        }
+
+        //! Render thread. Channels past numChannels repeat the last one given, extra ones are ignored.
+        void Write(const float* const* channels, int numChannels, int frames)
+        {
+            const int offset = Reserve(frames);
+            for (int ch = 0; ch < m_numChannels; ++ch)
+            {
+                const float* src = channels[AZStd::min(ch, numChannels - 1)];
+                AZStd::copy(src, src + frames, Channel(ch) + offset);
+            }
+        }
+
+        //! Render thread. Averages every channel given into each of ours.
+        void WriteDownmix(const float* const* channels, int numChannels, int frames)
+        {
+            const int offset = Reserve(frames);
+            float* dst = Channel(0) + offset;
+            const float scale = 1.0f / static_cast<float>(numChannels);
+            AZStd::fill(dst, dst + frames, 0.0f);
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                const float* src = channels[ch];
+                for (int i = 0; i < frames; ++i)
+                {
+                    dst[i] += src[i] * scale;
+                }
+            }
+            for (int ch = 1; ch < m_numChannels; ++ch)
+            {
+                AZStd::copy(dst, dst + frames, Channel(ch) + offset);
+            }
+        }
+
+        //! Render thread.
+        void WriteSilence(int frames)
+        {
+            const int offset = Reserve(frames);
+            for (int ch = 0; ch < m_numChannels; ++ch)
+            {
+                AZStd::fill(Channel(ch) + offset, Channel(ch) + offset + frames, 0.0f);
+            }
+        }
+
+        //! Render thread, fills GetNumChannels() channels.
+        void Read(float* const* channels, int frames)
+        {
+            AZ_Assert(frames <= GetSize(), "Reading %d samples from a FIFO holding %d", frames, GetSize());
+            for (int ch = 0; ch < m_numChannels; ++ch)
+            {
+                const float* src = Channel(ch) + m_begin;
+                AZStd::copy(src, src + frames, channels[ch]);
+            }
+            m_begin += frames;
+            if (m_begin == m_end)
+            {
+                Clear();
+            }
+        }
+
+    private:
+        float* Channel(int ch) { return m_samples.data() + static_cast<size_t>(ch) * m_capacity; }
+
+        //! Moves what is left to the front once the tail is too short, cheaper than wrapping every copy.
+        int Reserve(int frames)
+        {
+            AZ_Assert(GetSize() + frames <= m_capacity, "ReblockingFifo overflow, %d + %d samples in %d", GetSize(), frames, m_capacity);
+            if (m_end + frames > m_capacity)
+            {
+                for (int ch = 0; ch < m_numChannels; ++ch)
+                {
+                    float* data = Channel(ch);
+                    AZStd::copy(data + m_begin, data + m_end, data);
+                }
+                m_end -= m_begin;
+                m_begin = 0;
+            }
+            const int offset = m_end;
+            m_end += frames;
+            return offset;
+        }
+
+        AZStd::vector<float> m_samples;
+        int m_numChannels = 0;
+        int m_capacity = 0;
+        int m_begin = 0;
+        int m_end = 0;
+    };
+
+    //! Lets Steam Audio run at a fixed frame size under LabSound quanta of any size.
+    //! Frames start on multiples of the frame size on the context's sample clock rather than when the node did,
+    //! so every node reblocking the same way renders its frames in the same quanta and runs the same latency behind.
+    class FrameReblocker
+    {
+    public:
+        //! Game thread. Either side may have no channels, a node without inputs only needs the output.
+        void Allocate(int inputChannels, int outputChannels, int frameSize, int maxQuantum)
+        {
+            m_frameSize = frameSize;
+            m_maxQuantum = maxQuantum;
+            // Neither side ever holds more than a quantum past a frame
+            m_input.Allocate(inputChannels, frameSize + maxQuantum);
+            m_output.Allocate(outputChannels, frameSize + maxQuantum);
+            m_quantum = 0;
+            m_latency = 0;
+        }
+
+        //! Render thread, first thing every quantum. Starts over on the frame grid when the quantum size changed or
+        //! quanta were skipped. Returns false for a quantum larger than the FIFOs were sized for.
+        bool Begin(AZ::u64 sampleFrame, int quantumSize)
+        {
+            if (quantumSize > m_maxQuantum || m_frameSize <= 0)
+            {
+                m_quantum = 0;
+                return false;
+            }
+
+            if (quantumSize != m_quantum || sampleFrame != m_nextSampleFrame)
+            {
+                m_quantum = quantumSize;
+                const int offset = static_cast<int>(sampleFrame % static_cast<AZ::u64>(m_frameSize));
+                const int step = Gcd(m_frameSize, quantumSize);
+                // The furthest into a frame any later quantum can end, which is how far the output has to trail
+                m_latency = m_frameSize - step + offset % step;
+
+                m_input.Clear();
+                m_output.Clear();
+                // Silence stands in for the part of the frame that played before this node did
+                m_input.WriteSilence(offset);
+                m_output.WriteSilence(m_latency - offset);
+            }
+
+            m_nextSampleFrame = sampleFrame + quantumSize;
+            m_frameCount = static_cast<int>((sampleFrame + quantumSize) / m_frameSize - sampleFrame / m_frameSize);
+            return true;
+        }
+
+        //! Render thread. The next Begin starts over on the frame grid with silence in both FIFOs.
+        void Reset() { m_quantum = 0; }
+
+        //! Frames and quanta line up, so a node can render straight into LabSound's buffers.
+        bool IsPassthrough() const { return m_quantum == m_frameSize && m_latency == 0; }
+        //! Samples the output trails the input by, 0 while frames and quanta line up.
+        int GetLatency() const { return m_latency; }
+        //! Frames ending inside the quantum passed to Begin.
+        int GetFrameCount() const { return m_frameCount; }
+        int GetFrameSize() const { return m_frameSize; }
+
+        ReblockingFifo& GetInput() { return m_input; }
+        ReblockingFifo& GetOutput() { return m_output; }
+
+    private:
+        static int Gcd(int a, int b)
+        {
+            while (b != 0)
+            {
+                const int t = a % b;
+                a = b;
+                b = t;
+            }
+            return a;
+        }
+
+        ReblockingFifo m_input;
+        ReblockingFifo m_output;
+        int m_frameSize = 0;
+        int m_maxQuantum = 0;
+        int m_quantum = 0;
+        int m_latency = 0;
+        int m_frameCount = 0;
+        AZ::u64 m_nextSampleFrame = 0;
+    };
+} // TuSteamAudio
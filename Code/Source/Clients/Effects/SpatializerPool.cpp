@@ -0,0 +1,90 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SpatializerPool.h"
+#include "SteamAudioHrtf.h"
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace TuSteamAudio;
+
+void SpatializerPool::Prewarm(lab::AudioContext& ac)
+{
+    AZ_PROFILE_FUNCTION(Audio);
+    const size_t count = AZStd::min(m_settings.m_prewarm, m_settings.m_maxSize);
+    while (m_free.size() + m_pending.size() < count)
+    {
+        auto node = std::make_shared<SteamAudioHrtfNode>(ac);
+        if (!node->isSpatialized())
+        {
+            break;
+        }
+        node->park();
+        m_free.push_back(AZStd::move(node));
+    }
+}
+
+void SpatializerPool::Clear()
+{
+    m_pending.clear();
+    m_free.clear();
+}
+
+std::shared_ptr<SteamAudioHrtfNode> SpatializerPool::Acquire(lab::AudioContext& ac)
+{
+    if (m_free.empty())
+    {
+        ++m_misses;
+        return std::make_shared<SteamAudioHrtfNode>(ac);
+    }
+
+    ++m_hits;
+    std::shared_ptr<SteamAudioHrtfNode> node = AZStd::move(m_free.back());
+    m_free.pop_back();
+    node->recycle();
+    return node;
+}
+
+void SpatializerPool::Release(std::shared_ptr<SteamAudioHrtfNode> node)
+{
+    // One still panning plainly would have to be upgraded first, it isn't worth keeping
+    if (!node || !node->isSpatialized() || m_free.size() + m_pending.size() >= m_settings.m_maxSize)
+    {
+        ++m_discarded;
+        return;
+    }
+    m_pending.push_back(AZStd::move(node));
+}
+
+void SpatializerPool::Update()
+{
+    for (size_t i = 0; i < m_pending.size();)
+    {
+        // The graph lets go of disconnected nodes on its own schedule, the render thread may still be processing this one
+        if (m_pending[i].use_count() > 1)
+        {
+            ++i;
+            continue;
+        }
+
+        m_pending[i]->park();
+        m_free.push_back(AZStd::move(m_pending[i]));
+        m_pending[i] = AZStd::move(m_pending.back());
+        m_pending.pop_back();
+    }
+}
+
+SpatializerPoolStats SpatializerPool::GetStats() const
+{
+    SpatializerPoolStats stats;
+    stats.m_hits = m_hits;
+    stats.m_misses = m_misses;
+    stats.m_discarded = m_discarded;
+    stats.m_free = static_cast<AZ::u32>(m_free.size());
+    stats.m_pending = static_cast<AZ::u32>(m_pending.size());
+    return stats;
+}
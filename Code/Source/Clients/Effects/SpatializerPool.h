@@ -0,0 +1,65 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <TuSteamAudio/Types.h>
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <memory>
+
+namespace lab
+{
+    class AudioContext;
+}
+
+namespace TuSteamAudio
+{
+    class SteamAudioHrtfNode;
+
+    struct SpatializerPoolSettings
+    {
+        //! Nodes created as soon as the system is Ready.
+        AZ::u32 m_prewarm = 8;
+        //! Most nodes kept, free and pending together. Released past that they are destroyed.
+        AZ::u32 m_maxSize = 32;
+    };
+
+    //! SteamAudioHrtf nodes kept fully initialized between effects, so a short lived player costs a reset
+    //! instead of creating and releasing every Steam Audio effect and buffer of its own.
+    //! Game thread only. Parked nodes are out of the audibility ranking and the simulator.
+    class SpatializerPool
+    {
+    public:
+        void SetSettings(const SpatializerPoolSettings& settings) { m_settings = settings; }
+
+        //! Fills the pool up to the prewarm count.
+        void Prewarm(lab::AudioContext& ac);
+        //! Destroys every node the pool holds, before the Phonon globals go.
+        void Clear();
+
+        //! A recycled node reset to the defaults when one is free, a new one otherwise.
+        std::shared_ptr<SteamAudioHrtfNode> Acquire(lab::AudioContext& ac);
+        //! Keeps the node for later if there is room. LabSound may still hold it, it is parked once it doesn't.
+        void Release(std::shared_ptr<SteamAudioHrtfNode> node);
+        //! Parks the released nodes nothing else holds anymore.
+        void Update();
+
+        SpatializerPoolStats GetStats() const;
+
+    private:
+        SpatializerPoolSettings m_settings;
+        //Released, waiting for the graph to drop its references
+        AZStd::vector<std::shared_ptr<SteamAudioHrtfNode>> m_pending;
+        //Parked, ready to be handed out
+        AZStd::vector<std::shared_ptr<SteamAudioHrtfNode>> m_free;
+        AZ::u64 m_hits = 0;
+        AZ::u64 m_misses = 0;
+        AZ::u64 m_discarded = 0;
+    };
+} // TuSteamAudio
@@ -5,6 +5,8 @@
  * For complete copyright and license terms please see the LICENSE at the root of this distribution.
  */
 #include "SteamAudioHrtf.h"
+#include "SteamAudioReflectionMixer.h"
+#include "SpatializerPool.h"
 
 #include <LabSound/core/AudioNodeInput.h>
 #include <LabSound/core/AudioNodeOutput.h>
@@ -16,6 +18,9 @@
 #include <AzCore/Math/MathUtils.h>
 #include <cmath>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/algorithm.h>
+#include <TuSteamAudio/Allocators.h>
 
 #include "imgui/imgui.h"
 #include "TuSteamAudio/Utils.h"
@@ -33,6 +38,31 @@ void SteamAudioHrtfNode::initialize()
     if (isInitialized())
         return;
 
+    // Neither is Phonon, both are there while the system is still initializing
+    m_listenerCache = TuSteamAudioInterface::Get()->GetListenerCache();
+    m_qualityController = TuSteamAudioInterface::Get()->GetQualityController();
+
+    // Until then process() pans the input plainly, SteamAudioHrtf upgrades the node once the system is Ready
+    if (TuSteamAudioInterface::Get()->GetReadiness() == SystemReadiness::Ready)
+    {
+        CreateSpatializer();
+    }
+
+    AudioNode::initialize();
+}
+
+bool SteamAudioHrtfNode::upgradeSpatializer()
+{
+    if (isInitialized() && !m_spatializerReady.load(AZStd::memory_order_relaxed) &&
+        TuSteamAudioInterface::Get()->GetReadiness() == SystemReadiness::Ready)
+    {
+        CreateSpatializer();
+    }
+    return m_spatializerReady.load(AZStd::memory_order_relaxed);
+}
+
+void SteamAudioHrtfNode::CreateSpatializer()
+{
     m_context = iplContextRetain(TuSteamAudioInterface::Get()->GetContext());
     m_hrtf = iplHRTFRetain(TuSteamAudioInterface::Get()->GetHrtf());
     m_scene = iplSceneRetain(TuSteamAudioInterface::Get()->GetRootScene());
@@ -51,8 +81,45 @@ void SteamAudioHrtfNode::initialize()
         m_binauralEffect = nullptr;
     }
 
+    // Cheap tier for voices the audibility manager can't afford HRTF for
+    IPLPanningEffectSettings panningSettings{};
+    panningSettings.speakerLayout.type = IPL_SPEAKERLAYOUTTYPE_STEREO;
+    err = iplPanningEffectCreate(m_context, &audioSettings, &panningSettings, &m_panningEffect);
+    if (err != IPL_STATUS_SUCCESS)
+    {
+        AZ_Error("SteamAudioHrtfNode", false, "Failed to create panning effect, the panning tier falls back to a stereo pan");
+        m_panningEffect = nullptr;
+    }
+    iplAudioBufferAllocate(m_context, 1, audioSettings.frameSize, &m_panningBuffer);
+    iplAudioBufferAllocate(m_context, 2, audioSettings.frameSize, &m_fadeBuffer);
+    iplAudioBufferAllocate(m_context, 2, audioSettings.frameSize, &m_hrtfFadeBuffer);
+
+    // Every input layout up front, the render thread only ever picks one
+    CreateDirectLayouts(audioSettings);
+
+    // Steam Audio's frame size can differ from LabSound's quantum, frames then go through the reblocker
+    const int maxQuantum = AZStd::max(Sune::SuneInterface::Get()->GetPeriodSizeInFrames(), static_cast<int>(audioSettings.frameSize));
+    m_reblocker.Allocate(MaxDirectChannels, 2, audioSettings.frameSize, maxQuantum);
+    iplAudioBufferAllocate(m_context, MaxDirectChannels, audioSettings.frameSize, &m_frameInput);
+    iplAudioBufferAllocate(m_context, 2, audioSettings.frameSize, &m_frameOutput);
+
+    m_audibility = TuSteamAudioInterface::Get()->GetAudibilityManager();
+    m_voice = m_audibility->Register();
+
+    SimulationManager* simulation = TuSteamAudioInterface::Get()->GetSimulationManager();
+    m_directSimulationEnabled = simulation && simulation->IsDirectEnabled();
+    m_reflectionsEnabled = simulation && simulation->IsReflectionsEnabled();
+    if (simulation)
+    {
+        m_directSettings = simulation->GetDirectSettings();
+    }
+
     IPLSourceSettings sourceSettings{};
     sourceSettings.flags = IPL_SIMULATIONFLAGS_DIRECT;
+    if (m_reflectionsEnabled)
+    {
+        sourceSettings.flags = static_cast<IPLSimulationFlags>(sourceSettings.flags | IPL_SIMULATIONFLAGS_REFLECTIONS);
+    }
 
     err = iplSourceCreate(m_simulator, &sourceSettings, &m_source);
     if (err != IPL_STATUS_SUCCESS)
@@ -65,19 +132,74 @@ void SteamAudioHrtfNode::initialize()
         iplSourceAdd(m_source, m_simulator);
     }
 
-    IPLReflectionEffectSettings refSettings = {};
-    refSettings.type = IPL_REFLECTIONEFFECTTYPE_CONVOLUTION;
-    refSettings.irSize = audioSettings.samplingRate * 2.0f;
-    refSettings.numChannels = 2;
+    // Only decided here. The convolution, its decoder and buffers are created once the simulation has an IR for
+    // this source, UpdateReflectionState sizes them then
+    m_reflectionsAvailable = m_reflectionsEnabled && m_source;
+    m_reflectionIdleLimit = simulation ? static_cast<int>(audioSettings.samplingRate * simulation->GetReflectionSettings().m_idleReleaseTime) : 0;
 
-    err = iplReflectionEffectCreate(m_context, &audioSettings, &refSettings, &m_reflectionEffect);
-    if (err != IPL_STATUS_SUCCESS)
+    if (m_reflectionsAvailable)
     {
-        AZ_Error("SteamAudioHrtfNode", false, "Failed to create reflection effect");
-        m_reflectionEffect = nullptr;
+        // Prefer the shared mixer, the final convolution and decode then run once for all sources
+        auto sharedMixer = TuSteamAudioInterface::Get()->GetReflectionMixer();
+        if (sharedMixer && sharedMixer->GetMixer())
+        {
+            m_reflectionMixer = iplReflectionMixerRetain(sharedMixer->GetMixer());
+        }
     }
 
-    AudioNode::initialize();
+    IPLSimulationFlags simulatedFlags = static_cast<IPLSimulationFlags>(0);
+    if (m_directSimulationEnabled)
+    {
+        simulatedFlags = static_cast<IPLSimulationFlags>(simulatedFlags | IPL_SIMULATIONFLAGS_DIRECT);
+    }
+    if (m_reflectionsAvailable)
+    {
+        simulatedFlags = static_cast<IPLSimulationFlags>(simulatedFlags | IPL_SIMULATIONFLAGS_REFLECTIONS);
+    }
+
+    if (m_source && simulatedFlags != 0)
+    {
+        m_simulationSource.m_source = m_source;
+        m_simulationSource.m_flags = simulatedFlags;
+        simulation->RegisterSource(&m_simulationSource);
+    }
+
+    // Effects for a newer HRTF are offered from the next tick on
+    m_gameHrtf = m_hrtf;
+    TuSteamAudioInterface::Get()->RegisterHrtfClient(this);
+
+    // The simulation hasn't seen anything set before now
+    PublishParameters();
+    m_spatializerReady.store(true, AZStd::memory_order_release);
+}
+
+void SteamAudioHrtfNode::park()
+{
+    if (m_audibility && m_voice != InvalidAudibilityVoiceId)
+    {
+        m_audibility->Unregister(m_voice);
+        m_voice = InvalidAudibilityVoiceId;
+    }
+    // The simulation threads take the source out of the simulator, nobody listens to its results
+    m_simulationSource.m_virtual.store(true, AZStd::memory_order_relaxed);
+
+    // Not processed anymore, so the render thread can't be holding the effect or its buffers whatever the state says
+    ReleaseReflectionEffect();
+    m_reflectionState.store(ReflectionState::Released, AZStd::memory_order_relaxed);
+}
+
+void SteamAudioHrtfNode::recycle()
+{
+    m_gameParameters = {};
+    PublishParameters();
+
+    if (m_audibility && m_voice == InvalidAudibilityVoiceId)
+    {
+        m_voice = m_audibility->Register();
+    }
+    // Ranked and simulated again from the first quantum it renders
+    m_simulationSource.m_virtual.store(false, AZStd::memory_order_relaxed);
+    m_resetPending.store(true, AZStd::memory_order_release);
 }
 
 void SteamAudioHrtfNode::uninitialize()
@@ -85,44 +207,93 @@ void SteamAudioHrtfNode::uninitialize()
     if (!isInitialized())
         return;
 
+    if (m_spatializerReady.load(AZStd::memory_order_relaxed))
+    {
+        ReleaseSpatializer();
+    }
+    m_listenerCache = nullptr;
+    m_qualityController = nullptr;
+
+    AudioNode::uninitialize();
+}
+
+void SteamAudioHrtfNode::ReleaseSpatializer()
+{
+    m_spatializerReady.store(false, AZStd::memory_order_release);
+
+    TuSteamAudioInterface::Get()->UnregisterHrtfClient(this);
+    ReleaseHrtfEffects(m_nextHrtf, m_nextBinauralEffect, m_nextReflectionDecodeEffect);
+    ReleaseHrtfEffects(m_fadeHrtf, m_fadeBinauralEffect, m_fadeReflectionDecodeEffect);
+    m_hrtfSwapState.store(HrtfSwapState::Idle, AZStd::memory_order_relaxed);
+    m_gameHrtf = nullptr;
+
+    if (m_simulationSource.m_source)
+    {
+        TuSteamAudioInterface::Get()->GetSimulationManager()->UnregisterSource(&m_simulationSource);
+        m_simulationSource.m_source = nullptr;
+    }
+
     if (m_source)
     {
-        iplSourceRemove(m_source, m_simulator);
+        // A virtual source may already have been taken out by the simulation threads
+        if (m_simulationSource.m_inSimulator)
+        {
+            iplSourceRemove(m_source, m_simulator);
+        }
         iplSourceRelease(&m_source);
         m_source = nullptr;
     }
 
-    if (m_directBuffer.numChannels > 0)
-    {
-        iplAudioBufferFree(m_context, &m_directBuffer);
-        m_directBuffer.numChannels = 0;
-    }
+    ReleaseDirectLayouts();
 
-    if (m_reflectionEffect)
+    if (m_reflectionMixer)
     {
-        iplReflectionEffectRelease(&m_reflectionEffect);
-        m_reflectionEffect = nullptr;
+        iplReflectionMixerRelease(&m_reflectionMixer);
+        m_reflectionMixer = nullptr;
     }
 
+    ReleaseReflectionEffect();
+    m_reflectionState.store(ReflectionState::Released, AZStd::memory_order_relaxed);
+    m_reflectionCreateFailed = false;
+    m_reflectionsAvailable = false;
+
     if (m_binauralEffect)
     {
         iplBinauralEffectRelease(&m_binauralEffect);
         m_binauralEffect = nullptr;
     }
 
-    if (m_directEffect)
+    if (m_panningEffect)
     {
-        iplDirectEffectRelease(&m_directEffect);
-        m_directEffect = nullptr;
+        iplPanningEffectRelease(&m_panningEffect);
+        m_panningEffect = nullptr;
     }
+    iplAudioBufferFree(m_context, &m_panningBuffer);
+    m_panningBuffer = {};
+    iplAudioBufferFree(m_context, &m_fadeBuffer);
+    m_fadeBuffer = {};
+    iplAudioBufferFree(m_context, &m_hrtfFadeBuffer);
+    m_hrtfFadeBuffer = {};
+    iplAudioBufferFree(m_context, &m_frameInput);
+    m_frameInput = {};
+    iplAudioBufferFree(m_context, &m_frameOutput);
+    m_frameOutput = {};
+
+    if (m_audibility)
+    {
+        if (m_voice != InvalidAudibilityVoiceId)
+        {
+            m_audibility->Unregister(m_voice);
+        }
+        m_audibility = nullptr;
+        m_voice = InvalidAudibilityVoiceId;
+    }
+    m_tierValid = false;
 
-    m_lastInputChannelCount = 0;
     iplSimulatorRelease(&m_simulator);
     iplSceneRelease(&m_scene);
     iplHRTFRelease(&m_hrtf);
     iplContextRelease(&m_context);
-
-    AudioNode::uninitialize();
 }
 
 SteamAudioHrtfNode::SteamAudioHrtfNode(lab::AudioContext& ac)
@@ -141,16 +312,24 @@ SteamAudioHrtfNode::~SteamAudioHrtfNode()
 void SteamAudioHrtfNode::process(lab::ContextRenderLock& r, int bufferSize)
 {
     AZ_PROFILE_FUNCTION(Audio);
-    if (bufferSize != Sune::SuneInterface::Get()->GetPeriodSizeInFrames())
+    RealtimeScope realtime;
+    // Inputs were pulled before process(), so this only measures the spatializer
+    QualityController::RenderTimer renderTimer(m_qualityController, r);
+
+    // Recycled from the spatializer pool, nothing of the last player may carry over
+    if (m_resetPending.exchange(false, AZStd::memory_order_acq_rel))
     {
-        return;
+        ResetRenderState();
     }
 
+    // Once per quantum, whatever the game thread published last
+    ReceiveParameters();
+
     lab::AudioBus* outputBus = output(0)->bus(r);
     if (outputBus == nullptr)
         return;
 
-    if (!isInitialized() || !input(0)->isConnected() || !m_binauralEffect)
+    if (!isInitialized() || !input(0)->isConnected())
     {
         outputBus->zero();
         return;
@@ -164,19 +343,43 @@ void SteamAudioHrtfNode::process(lab::ContextRenderLock& r, int bufferSize)
         return;
     }
 
-    // Get listener position and orientation from AudioContext
-    auto listener = r.context()->listener();
+    if (!m_spatializerReady.load(AZStd::memory_order_acquire))
+    {
+        RenderUnspatialized(r, *inputBus, *outputBus, bufferSize);
+        return;
+    }
 
-    // Calculate direction from listener to source
-    // Convert O3DE position to LabSound/Steam Audio coords using the existing utility
-    auto sourcePos = Sune::ToLab(m_transform.GetTranslation());
+    if (!m_binauralEffect)
+    {
+        outputBus->zero();
+        return;
+    }
 
-    IPLVector3 sourceIPL = { sourcePos.x, sourcePos.y, sourcePos.z };
-    IPLVector3 listenerIPL = { listener->positionX()->value(), listener->positionY()->value(), listener->positionZ()->value() };
-    IPLVector3 forwardIPL = { listener->forwardX()->value(), listener->forwardY()->value(), listener->forwardZ()->value() };
-    IPLVector3 upIPL = { listener->upX()->value(), listener->upY()->value(), listener->upZ()->value() };
+    if (!m_reblocker.Begin(r.context()->currentSampleFrame(), bufferSize))
+    {
+        AZ_ErrorOnce("SteamAudioHrtfNode", false, "Quantum of %d samples is larger than the node was prepared for", bufferSize);
+        outputBus->zero();
+        return;
+    }
 
-    IPLVector3 direction = iplCalculateRelativeDirection(m_context, sourceIPL, listenerIPL, forwardIPL, upIPL);
+    // A new HRTF is only picked up between quanta, the crossfade then runs across the frames that follow
+    BeginHrtfSwap();
+    AdvanceReflectionIdle(bufferSize);
+
+    // Shared snapshot, only the first node of the quantum reads the LabSound params
+    const ListenerState& listener = m_listenerCache->Capture(r);
+    if (listener.m_generation != m_listenerGeneration)
+    {
+        const IPLCoordinateSpace3& coords = listener.m_coords;
+        ListenerPose listenerPose;
+        listenerPose.m_position = AZ::Vector3(coords.origin.x, coords.origin.y, coords.origin.z);
+        listenerPose.m_forward = AZ::Vector3(coords.ahead.x, coords.ahead.y, coords.ahead.z);
+        listenerPose.m_up = AZ::Vector3(coords.up.x, coords.up.y, coords.up.z);
+
+        // The listener has no timestamp of its own, the quantum it moved on stands in for it
+        m_listenerRamp.Push(listenerPose, listener.m_movedTime);
+        m_listenerGeneration = listener.m_generation;
+    }
 
     // Setup input buffer - LabSound already uses a deinterleaved format
     const float* inputChannels[16];
@@ -201,122 +404,905 @@ void SteamAudioHrtfNode::process(lab::ContextRenderLock& r, int bufferSize)
     outBuffer.numSamples = bufferSize;
     outBuffer.data = outputChannels;
 
-    EnsureDirectEffectInitialized(inputBus->numberOfChannels());
+    m_sharedReflectionsMixed = false;
+    if (m_reblocker.IsPassthrough())
+    {
+        RenderFrame(r, inBuffer, outBuffer);
+        AdvanceHrtfSwap(bufferSize);
+        return;
+    }
+
+    // Steam Audio runs on its own frame grid, the quantum goes through the FIFOs
+    ReblockingFifo& inputFifo = m_reblocker.GetInput();
+    IPLAudioBuffer frameInput = m_frameInput;
+    if (inBuffer.numChannels > MaxDirectChannels)
+    {
+        inputFifo.WriteDownmix(inBuffer.data, inBuffer.numChannels, bufferSize);
+        frameInput.numChannels = 1;
+    }
+    else
+    {
+        inputFifo.Write(inBuffer.data, inBuffer.numChannels, bufferSize);
+        frameInput.numChannels = inBuffer.numChannels;
+    }
 
-    UpdateBuffers(inputBus->numberOfChannels(), outputBus->numberOfChannels(), bufferSize);
+    const int frameSize = m_reblocker.GetFrameSize();
+    while (inputFifo.GetSize() >= frameSize)
+    {
+        inputFifo.Read(m_frameInput.data, frameSize);
+        RenderFrame(r, frameInput, m_frameOutput);
+        AdvanceHrtfSwap(frameSize);
+        m_reblocker.GetOutput().Write(m_frameOutput.data, m_frameOutput.numChannels, frameSize);
+    }
+    m_reblocker.GetOutput().Read(outBuffer.data, bufferSize);
+}
+
+void SteamAudioHrtfNode::RenderUnspatialized(lab::ContextRenderLock& r, lab::AudioBus& inputBus, lab::AudioBus& outputBus, int bufferSize)
+{
+    UnspatializedSource source;
+    const auto sourcePos = Sune::ToLab(m_renderParameters.m_transform.GetTranslation());
+    source.m_position = IPLVector3{ sourcePos.x, sourcePos.y, sourcePos.z };
+    source.m_distanceModelType = m_renderParameters.m_distanceModelType;
+    source.m_minDistance = m_renderParameters.m_minDistance;
+    source.m_spatialBlend = m_renderParameters.m_spatialBlend;
+    source.m_attenuationTable = &m_attenuationTable;
+
+    const float* inputChannels[UnspatializedPanner::MaxChannels];
+    const int numInputChannels = AZStd::min(inputBus.numberOfChannels(), UnspatializedPanner::MaxChannels);
+    for (int ch = 0; ch < numInputChannels; ++ch)
+    {
+        inputChannels[ch] = inputBus.channel(ch)->data();
+    }
+    float* outputChannels[UnspatializedPanner::MaxChannels];
+    const int numOutputChannels = AZStd::min(outputBus.numberOfChannels(), UnspatializedPanner::MaxChannels);
+    for (int ch = 0; ch < numOutputChannels; ++ch)
+    {
+        outputChannels[ch] = outputBus.channel(ch)->mutableData();
+    }
+
+    m_unspatializedPanner.Render(m_listenerCache->Capture(r).m_coords, source, inputChannels, numInputChannels,
+        outputChannels, numOutputChannels, bufferSize);
+}
+
+void SteamAudioHrtfNode::RenderFrame(lab::ContextRenderLock& r, IPLAudioBuffer& inBuffer, IPLAudioBuffer& outBuffer)
+{
+    // Poses are taken from the middle of the frame, gains ramp to where it ends
+    const float frameSeconds = static_cast<float>(inBuffer.numSamples / r.context()->sampleRate());
+    const ListenerPose listenerMid = m_listenerRamp.Evaluate(frameSeconds * 0.5f);
+    const ListenerPose listenerEnd = m_listenerRamp.Evaluate(frameSeconds);
+    const AZ::Vector3 sourceMid = m_sourceRamp.Evaluate(frameSeconds * 0.5f);
+    const AZ::Vector3 sourceEnd = m_sourceRamp.Evaluate(frameSeconds);
+    // Settled ramps give the same poses every frame, so the derived parameters can be reused
+    const bool settled = m_sourceRamp.IsSettled() && m_listenerRamp.IsSettled();
+    m_listenerRamp.Advance(frameSeconds);
+    m_sourceRamp.Advance(frameSeconds);
+
+    // More channels than any prepared layout, spatialize the mono downmix
+    IPLAudioBuffer* directInput = &inBuffer;
+    if (inBuffer.numChannels > MaxDirectChannels)
+    {
+        iplAudioBufferDownmix(m_context, &inBuffer, &m_downmixBuffer);
+        directInput = &m_downmixBuffer;
+    }
+    SelectDirectLayout(directInput->numChannels);
 
     if (!m_directEffect)
     {
-        outputBus->zero();
+        ZeroBuffer(outBuffer);
+        return;
+    }
+
+    const HrtfDirectPath& path = UpdateDirectPath(sourceMid, sourceEnd, listenerMid, listenerEnd, settled);
+
+    // Ranked on distance gain alone, occlusion stops being simulated once a voice is virtual
+    UpdateAudibilityTier(r, path.m_distanceGain);
+    const bool fading = m_fadePosition < m_fadeLength;
+    if (m_tier == AudibilityTier::Virtual && !fading)
+    {
+        // The input was still pulled, so the player keeps its position
+        m_distanceGain = path.m_distanceGain;
+        ZeroBuffer(outBuffer);
+        return;
+    }
+
+    const auto renderStart = AZStd::chrono::steady_clock::now();
+
+    // Distance gain is ramped below rather than applied by the direct effect, a step per frame is audible
+    IPLDirectEffectParams directParams{};
+    directParams.flags = IPL_DIRECTEFFECTFLAGS_APPLYAIRABSORPTION;
+    for (int band = 0; band < 3; ++band)
+    {
+        directParams.airAbsorption[band] = path.m_airAbsorption[band];
+    }
+
+    // Occlusion/transmission from the direct simulation thread, last published result
+    IPLDirectEffectParams simulatedDirect{};
+    if (m_simulationSource.m_direct.Read(simulatedDirect))
+    {
+        directParams.flags = static_cast<IPLDirectEffectFlags>(directParams.flags |
+            IPL_DIRECTEFFECTFLAGS_APPLYOCCLUSION | IPL_DIRECTEFFECTFLAGS_APPLYTRANSMISSION);
+        directParams.occlusion = simulatedDirect.occlusion;
+        directParams.transmissionType = IPL_TRANSMISSIONTYPE_FREQDEPENDENT;
+        for (int band = 0; band < 3; ++band)
+        {
+            directParams.transmission[band] = simulatedDirect.transmission[band];
+        }
+    }
+
+    iplDirectEffectApply(m_directEffect, &directParams, directInput, &m_directBuffer);
+
+    const float distanceGainFrom = m_distanceGain < 0.0f ? path.m_distanceGain : m_distanceGain;
+    ApplyGainRamp(m_directBuffer, distanceGainFrom, path.m_distanceGain);
+    m_distanceGain = path.m_distanceGain;
+
+    RenderTier(m_tier, path, inBuffer, outBuffer, listenerMid);
+    if (fading)
+    {
+        RenderTier(m_fadeFromTier, path, inBuffer, m_fadeBuffer, listenerMid);
+        ApplyCrossfade(outBuffer);
+    }
+    else if (m_tier == AudibilityTier::Full && m_audibility)
+    {
+        m_audibility->ReportFullCost(AZStd::chrono::duration<double>(AZStd::chrono::steady_clock::now() - renderStart).count());
+    }
+}
+
+void SteamAudioHrtfNode::UpdateAudibilityTier(lab::ContextRenderLock& r, float audibility)
+{
+    AudibilityTier tier = m_audibility ? m_audibility->Update(r, m_voice, audibility) : AudibilityTier::Full;
+
+    // The global quality caps what any voice may render at
+    const SpatialQuality quality = m_qualityController ? m_qualityController->GetQuality() : SpatialQuality::Bilinear;
+    if (quality == SpatialQuality::StereoPan)
+    {
+        tier = AZStd::min(tier, AudibilityTier::StereoPan);
+    }
+    else if (quality == SpatialQuality::Panning)
+    {
+        tier = AZStd::min(tier, AudibilityTier::Panning);
+    }
+
+    if (tier == AudibilityTier::Panning && !m_panningEffect)
+    {
+        tier = AudibilityTier::StereoPan;
+    }
+
+    if (!m_tierValid)
+    {
+        // Nothing to fade from on the first frame
+        m_tier = tier;
+        m_fadeFromTier = tier;
+        m_tierValid = true;
+    }
+    else if (tier != m_tier && m_fadePosition >= m_fadeLength)
+    {
+        // Changes wait for the running crossfade, a voice never fades between three tiers at once
+        if (tier == AudibilityTier::Full)
+        {
+            // Whatever the HRTF and reflections held from the last time this voice was Full is stale
+            iplBinauralEffectReset(m_binauralEffect);
+            if (m_reflectionState.load(AZStd::memory_order_acquire) == ReflectionState::Active)
+            {
+                iplReflectionEffectReset(m_reflectionEffect);
+            }
+        }
+
+        m_fadeFromTier = m_tier;
+        m_tier = tier;
+        const float crossfadeTime = m_audibility ? m_audibility->GetRenderSettings().m_crossfadeTime : AudibilitySettings().m_crossfadeTime;
+        m_fadeLength = AZStd::max(1, static_cast<int>(crossfadeTime * r.context()->sampleRate()));
+        m_fadePosition = 0;
+    }
+
+    // Only gives up its simulator slot once it is silent, the simulation threads pick this up on their next run
+    const bool virtualized = m_tier == AudibilityTier::Virtual && m_fadePosition >= m_fadeLength;
+    m_simulationSource.m_virtual.store(virtualized, AZStd::memory_order_relaxed);
+}
+
+void SteamAudioHrtfNode::RenderTier(AudibilityTier tier, const HrtfDirectPath& path, IPLAudioBuffer& inBuffer,
+    IPLAudioBuffer& outBuffer, const ListenerPose& listenerMid)
+{
+    switch (tier)
+    {
+    case AudibilityTier::Virtual:
+        ZeroBuffer(outBuffer);
+        break;
+    case AudibilityTier::StereoPan:
+        RenderPanning(path, outBuffer, true);
+        break;
+    case AudibilityTier::Panning:
+        RenderPanning(path, outBuffer, false);
+        break;
+    case AudibilityTier::Full:
+    {
+        const bool nearest = m_qualityController && m_qualityController->GetQuality() != SpatialQuality::Bilinear;
+
+        IPLBinauralEffectParams params{};
+        params.direction = path.m_direction;
+        params.interpolation = nearest ? IPL_HRTFINTERPOLATION_NEAREST : m_renderParameters.m_interpolation;
+        params.spatialBlend = path.m_spatialBlend;
+        params.hrtf = m_hrtf;
+        params.peakDelays = nullptr;
+        iplBinauralEffectApply(m_binauralEffect, &params, &m_directBuffer, &outBuffer);
+
+        if (m_fadeBinauralEffect && m_hrtfSwapState.load(AZStd::memory_order_relaxed) == HrtfSwapState::Fading)
+        {
+            params.hrtf = m_fadeHrtf;
+            iplBinauralEffectApply(m_fadeBinauralEffect, &params, &m_directBuffer, &m_hrtfFadeBuffer);
+            m_hrtfFade.Apply(m_hrtfFadeBuffer, outBuffer);
+        }
+
+        if (m_reflectionsAvailable)
+        {
+            IPLCoordinateSpace3 listenerCoords = {};
+            listenerCoords.ahead = ToIPL(listenerMid.m_forward);
+            listenerCoords.up = ToIPL(listenerMid.m_up);
+            listenerCoords.right = ComputeRightVector(listenerCoords.ahead, listenerCoords.up);
+            listenerCoords.origin = ToIPL(listenerMid.m_position);
+            ApplyReflections(inBuffer, outBuffer, listenerCoords);
+        }
+        break;
+    }
+    }
+}
+
+void SteamAudioHrtfNode::RenderPanning(const HrtfDirectPath& path, IPLAudioBuffer& outBuffer, bool stereoPan)
+{
+    IPLAudioBuffer* monoBuffer = &m_directBuffer;
+    if (m_directBuffer.numChannels > 1)
+    {
+        iplAudioBufferDownmix(m_context, &m_directBuffer, &m_panningBuffer);
+        monoBuffer = &m_panningBuffer;
+    }
+
+    if (stereoPan)
+    {
+        // Only the left/right component of the direction counts
+        float gains[2];
+        ConstantPowerPan(path.m_direction.x, gains);
+        const float* src = monoBuffer->data[0];
+        for (int ch = 0; ch < outBuffer.numChannels; ++ch)
+        {
+            const float gain = gains[AZStd::min(ch, 1)];
+            float* dst = outBuffer.data[ch];
+            for (int i = 0; i < outBuffer.numSamples; ++i)
+            {
+                dst[i] = src[i] * gain;
+            }
+        }
+    }
+    else
+    {
+        IPLPanningEffectParams params{};
+        params.direction = path.m_direction;
+        iplPanningEffectApply(m_panningEffect, &params, monoBuffer, &outBuffer);
+    }
+
+    // Panning has no spatial blend of its own, mix the dry share back in the way the binaural effect does
+    if (path.m_spatialBlend < 1.0f)
+    {
+        const float wet = path.m_spatialBlend;
+        const float dry = 1.0f - wet;
+        for (int ch = 0; ch < outBuffer.numChannels; ++ch)
+        {
+            const float* src = m_directBuffer.data[AZStd::min(ch, m_directBuffer.numChannels - 1)];
+            float* dst = outBuffer.data[ch];
+            for (int i = 0; i < outBuffer.numSamples; ++i)
+            {
+                dst[i] = dst[i] * wet + src[i] * dry;
+            }
+        }
+    }
+}
+
+void SteamAudioHrtfNode::ApplyCrossfade(IPLAudioBuffer& outBuffer)
+{
+    // Both tiers render the same source, so a straight line keeps the level steady
+    const float step = 1.0f / static_cast<float>(m_fadeLength);
+    for (int ch = 0; ch < outBuffer.numChannels; ++ch)
+    {
+        const float* from = m_fadeBuffer.data[AZStd::min(ch, m_fadeBuffer.numChannels - 1)];
+        float* to = outBuffer.data[ch];
+        for (int i = 0; i < outBuffer.numSamples; ++i)
+        {
+            const float gain = AZStd::min(static_cast<float>(m_fadePosition + i + 1) * step, 1.0f);
+            to[i] = from[i] + (to[i] - from[i]) * gain;
+        }
+    }
+    m_fadePosition = AZStd::min(m_fadePosition + outBuffer.numSamples, m_fadeLength);
+}
+
+void SteamAudioHrtfNode::BeginHrtfSwap()
+{
+    HrtfSwapState offered = HrtfSwapState::Offered;
+    if (!m_hrtfSwapState.compare_exchange_strong(offered, HrtfSwapState::Fading, AZStd::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    // The game thread keeps its hands off both sets of effects until they are Retired
+    m_fadeHrtf = m_hrtf;
+    m_fadeBinauralEffect = m_binauralEffect;
+    m_fadeReflectionDecodeEffect = m_reflectionDecodeEffect;
+    m_hrtf = m_nextHrtf;
+    m_binauralEffect = m_nextBinauralEffect;
+    if (m_nextReflectionDecodeEffect)
+    {
+        m_reflectionDecodeEffect = m_nextReflectionDecodeEffect;
+    }
+    else
+    {
+        // Decoder for the new HRTF couldn't be created, keep decoding with the old one
+        m_fadeReflectionDecodeEffect = nullptr;
+    }
+    m_nextHrtf = nullptr;
+    m_nextBinauralEffect = nullptr;
+    m_nextReflectionDecodeEffect = nullptr;
+
+    const int frameSize = m_reblocker.GetFrameSize();
+    m_hrtfFade.Start(frameSize, frameSize);
+}
+
+void SteamAudioHrtfNode::AdvanceHrtfSwap(int numSamples)
+{
+    if (m_hrtfSwapState.load(AZStd::memory_order_relaxed) == HrtfSwapState::Fading && m_hrtfFade.Advance(numSamples))
+    {
+        m_hrtfSwapState.store(HrtfSwapState::Retired, AZStd::memory_order_release);
+    }
+}
+
+void SteamAudioHrtfNode::ReleaseHrtfEffects(IPLHRTF& hrtf, IPLBinauralEffect& binauralEffect, IPLAmbisonicsDecodeEffect& decodeEffect)
+{
+    if (binauralEffect)
+    {
+        iplBinauralEffectRelease(&binauralEffect);
+        binauralEffect = nullptr;
+    }
+
+    if (decodeEffect)
+    {
+        iplAmbisonicsDecodeEffectRelease(&decodeEffect);
+        decodeEffect = nullptr;
+    }
+
+    if (hrtf)
+    {
+        iplHRTFRelease(&hrtf);
+        hrtf = nullptr;
+    }
+}
+
+void SteamAudioHrtfNode::UpdateHrtf(IPLHRTF hrtf)
+{
+    if (m_hrtfSwapState.load(AZStd::memory_order_acquire) == HrtfSwapState::Retired)
+    {
+        ReleaseHrtfEffects(m_fadeHrtf, m_fadeBinauralEffect, m_fadeReflectionDecodeEffect);
+        m_hrtfSwapState.store(HrtfSwapState::Idle, AZStd::memory_order_release);
+    }
+
+    // Every node gets this tick, the reflection effect is looked after here as well
+    UpdateReflectionState();
+
+    if (hrtf == m_gameHrtf)
+    {
+        return;
+    }
+
+    // Not picked up yet, a node that isn't being processed never takes it, so it is replaced instead
+    HrtfSwapState offered = HrtfSwapState::Offered;
+    if (m_hrtfSwapState.compare_exchange_strong(offered, HrtfSwapState::Idle, AZStd::memory_order_acq_rel))
+    {
+        ReleaseHrtfEffects(m_nextHrtf, m_nextBinauralEffect, m_nextReflectionDecodeEffect);
+    }
+
+    if (m_hrtfSwapState.load(AZStd::memory_order_acquire) != HrtfSwapState::Idle)
+    {
+        return;
+    }
+
+    // Effects that can't be created aren't retried every tick, the node stays on the HRTF it has
+    m_gameHrtf = hrtf;
+    IPLAudioSettings audioSettings = TuSteamAudioInterface::Get()->GetAudioSettings();
+
+    IPLBinauralEffectSettings effectSettings{};
+    effectSettings.hrtf = hrtf;
+    if (iplBinauralEffectCreate(m_context, &audioSettings, &effectSettings, &m_nextBinauralEffect) != IPL_STATUS_SUCCESS)
+    {
+        AZ_Error("SteamAudioHrtfNode", false, "Failed to create binaural effect for the new HRTF");
+        m_nextBinauralEffect = nullptr;
+        return;
+    }
+
+    // Only nodes decoding their own reflections have a decoder to replace
+    if (m_reflectionOutBuffer.numChannels > 0)
+    {
+        IPLAmbisonicsDecodeEffectSettings decodeSettings{};
+        decodeSettings.maxOrder = m_reflectionOrder;
+        decodeSettings.hrtf = hrtf;
+        if (iplAmbisonicsDecodeEffectCreate(m_context, &audioSettings, &decodeSettings, &m_nextReflectionDecodeEffect) != IPL_STATUS_SUCCESS)
+        {
+            AZ_Warning("SteamAudioHrtfNode", false, "Failed to create reflection decode effect for the new HRTF, reflections keep the old one");
+            m_nextReflectionDecodeEffect = nullptr;
+        }
+    }
+
+    m_nextHrtf = iplHRTFRetain(hrtf);
+    m_hrtfSwapState.store(HrtfSwapState::Offered, AZStd::memory_order_release);
+}
+
+void SteamAudioHrtfNode::UpdateReflectionState()
+{
+    // The decoder changes hands with the HRTF, it is only created or freed while no swap is under way
+    if (m_hrtfSwapState.load(AZStd::memory_order_acquire) != HrtfSwapState::Idle)
+    {
         return;
     }
 
-    // IPLSimulationOutputs outputs = {};
-    // iplSourceGetOutputs(m_source, IPL_SIMULATIONFLAGS_REFLECTIONS, &outputs);
+    switch (m_reflectionState.load(AZStd::memory_order_acquire))
+    {
+    case ReflectionState::Requested:
+        // One that can't be created isn't retried every tick, the source stays dry
+        if (!m_reflectionCreateFailed && CreateReflectionEffect())
+        {
+            m_reflectionState.store(ReflectionState::Active, AZStd::memory_order_release);
+        }
+        break;
+    case ReflectionState::Idle:
+        ReleaseReflectionEffect();
+        m_reflectionState.store(ReflectionState::Released, AZStd::memory_order_release);
+        break;
+    default:
+        break;
+    }
+}
+
+bool SteamAudioHrtfNode::CreateReflectionEffect()
+{
+    SimulationManager* simulation = TuSteamAudioInterface::Get()->GetSimulationManager();
+    const IPLAudioSettings audioSettings = TuSteamAudioInterface::Get()->GetAudioSettings();
+
+    // Sized for the IRs the simulation produces, ambisonic of its order and as long as its duration
+    const ReflectionSimulationSettings& reflectionSettings = simulation->GetReflectionSettings();
+    m_reflectionOrder = reflectionSettings.m_order;
+    m_reflectionIrSize = static_cast<int>(audioSettings.samplingRate * reflectionSettings.m_duration);
+    const int numChannels = (m_reflectionOrder + 1) * (m_reflectionOrder + 1);
 
-    float distanceAttenuation = iplDistanceAttenuationCalculate(m_context, sourceIPL, listenerIPL, &m_distanceModel);
+    // Only this thread allocates in the category, so the difference is all this source's
+    const PhononAllocationScope allocationScope(PhononAllocationCategory::Reflections);
+    const AZ::u64 liveBytes = TuSteamAudioInterface::Get()->GetPhononAllocationStats(PhononAllocationCategory::Reflections).m_liveBytes;
+
+    // Without the shared mixer the source decodes its own. A parked node may have been handed one by an HRTF swap already
+    if (!m_reflectionMixer && !m_reflectionDecodeEffect)
+    {
+        IPLAmbisonicsDecodeEffectSettings decodeSettings{};
+        decodeSettings.maxOrder = m_reflectionOrder;
+        decodeSettings.hrtf = m_hrtf;
+        if (iplAmbisonicsDecodeEffectCreate(m_context, &audioSettings, &decodeSettings, &m_reflectionDecodeEffect) != IPL_STATUS_SUCCESS)
+        {
+            AZ_Error("SteamAudioHrtfNode", false, "Failed to create reflection decode effect");
+            m_reflectionDecodeEffect = nullptr;
+            m_reflectionCreateFailed = true;
+            return false;
+        }
+    }
+
+    IPLReflectionEffectSettings refSettings = {};
+    refSettings.type = IPL_REFLECTIONEFFECTTYPE_CONVOLUTION;
+    refSettings.irSize = m_reflectionIrSize;
+    refSettings.numChannels = numChannels;
+
+    if (iplReflectionEffectCreate(m_context, &audioSettings, &refSettings, &m_reflectionEffect) != IPL_STATUS_SUCCESS)
+    {
+        AZ_Error("SteamAudioHrtfNode", false, "Failed to create reflection effect");
+        m_reflectionEffect = nullptr;
+        m_reflectionCreateFailed = true;
+        ReleaseReflectionEffect();
+        return false;
+    }
+
+    iplAudioBufferAllocate(m_context, 1, audioSettings.frameSize, &m_monoBuffer);
+    iplAudioBufferAllocate(m_context, numChannels, audioSettings.frameSize, &m_reflectionBuffer);
+    if (m_reflectionDecodeEffect)
+    {
+        iplAudioBufferAllocate(m_context, 2, audioSettings.frameSize, &m_reflectionOutBuffer);
+    }
+
+    m_reflectionStateBytes = TuSteamAudioInterface::Get()->GetPhononAllocationStats(PhononAllocationCategory::Reflections).m_liveBytes - liveBytes;
+    return true;
+}
+
+void SteamAudioHrtfNode::ReleaseReflectionEffect()
+{
+    if (m_reflectionEffect)
+    {
+        iplReflectionEffectRelease(&m_reflectionEffect);
+        m_reflectionEffect = nullptr;
+    }
+
+    if (m_reflectionDecodeEffect)
+    {
+        iplAmbisonicsDecodeEffectRelease(&m_reflectionDecodeEffect);
+        m_reflectionDecodeEffect = nullptr;
+    }
+
+    if (m_reflectionBuffer.numChannels > 0)
+    {
+        iplAudioBufferFree(m_context, &m_monoBuffer);
+        iplAudioBufferFree(m_context, &m_reflectionBuffer);
+        m_monoBuffer = {};
+        m_reflectionBuffer = {};
+    }
+
+    if (m_reflectionOutBuffer.numChannels > 0)
+    {
+        iplAudioBufferFree(m_context, &m_reflectionOutBuffer);
+        m_reflectionOutBuffer = {};
+    }
+    m_reflectionStateBytes = 0;
+}
+
+void SteamAudioHrtfNode::AdvanceReflectionIdle(int numSamples)
+{
+    if (m_reflectionState.load(AZStd::memory_order_relaxed) != ReflectionState::Active)
+    {
+        return;
+    }
+
+    // Virtual, panned or silent for long enough, its IR history isn't worth keeping
+    m_reflectionIdleSamples += numSamples;
+    if (m_reflectionIdleSamples > m_reflectionIdleLimit)
+    {
+        m_reflectionState.store(ReflectionState::Idle, AZStd::memory_order_release);
+    }
+}
+
+void SteamAudioHrtfNode::ApplyReflections(IPLAudioBuffer& inBuffer, IPLAudioBuffer& outBuffer, const IPLCoordinateSpace3& listener)
+{
+    // Latest published simulation result, never waits on the simulation thread
+    IPLReflectionEffectParams reflectionParams{};
+    if (!m_simulationSource.m_reflections.Read(reflectionParams) || !reflectionParams.ir)
+    {
+        return;
+    }
+
+    // The game thread creates the effect on its next tick, the source stays dry until then
+    ReflectionState state = m_reflectionState.load(AZStd::memory_order_acquire);
+    if (state != ReflectionState::Active)
+    {
+        if (state == ReflectionState::Released &&
+            m_reflectionState.compare_exchange_strong(state, ReflectionState::Requested, AZStd::memory_order_acq_rel))
+        {
+            m_reflectionIdleSamples = 0;
+        }
+        return;
+    }
+    m_reflectionIdleSamples = 0;
+
+    reflectionParams.type = IPL_REFLECTIONEFFECTTYPE_CONVOLUTION;
+    reflectionParams.numChannels = m_reflectionBuffer.numChannels;
+    reflectionParams.irSize = m_reflectionIrSize;
+
+    iplAudioBufferDownmix(m_context, &inBuffer, &m_monoBuffer);
+
+    if (m_reflectionMixer)
+    {
+        // The shared mixer renders one frame of contributions at a time, a quantum spanning several frames
+        // only sends it the first. The system component keeps frames at least a quantum long while it is in use.
+        if (m_sharedReflectionsMixed)
+        {
+            return;
+        }
+        m_sharedReflectionsMixed = true;
+
+        // Output goes to the shared mixer, SteamAudioReflectionMixerNode renders it for every source at once
+        iplReflectionEffectApply(m_reflectionEffect, &reflectionParams, &m_monoBuffer, &m_reflectionBuffer, m_reflectionMixer);
+        return;
+    }
+
+    iplReflectionEffectApply(m_reflectionEffect, &reflectionParams, &m_monoBuffer, &m_reflectionBuffer, nullptr);
+
+    IPLAmbisonicsDecodeEffectParams decodeParams{};
+    decodeParams.order = m_reflectionOrder;
+    decodeParams.hrtf = m_hrtf;
+    decodeParams.orientation = listener;
+    decodeParams.binaural = IPL_TRUE;
+    iplAmbisonicsDecodeEffectApply(m_reflectionDecodeEffect, &decodeParams, &m_reflectionBuffer, &m_reflectionOutBuffer);
+
+    if (m_fadeReflectionDecodeEffect && m_hrtfSwapState.load(AZStd::memory_order_relaxed) == HrtfSwapState::Fading)
+    {
+        // The direct path is done with the fade buffer by now
+        decodeParams.hrtf = m_fadeHrtf;
+        iplAmbisonicsDecodeEffectApply(m_fadeReflectionDecodeEffect, &decodeParams, &m_reflectionBuffer, &m_hrtfFadeBuffer);
+        m_hrtfFade.Apply(m_hrtfFadeBuffer, m_reflectionOutBuffer);
+    }
+
+    iplAudioBufferMix(m_context, &m_reflectionOutBuffer, &outBuffer);
+}
+
+const HrtfDirectPath& SteamAudioHrtfNode::UpdateDirectPath(const AZ::Vector3& sourceMid, const AZ::Vector3& sourceEnd,
+    const ListenerPose& listenerMid, const ListenerPose& listenerEnd, bool settled)
+{
+    // Static emitters heard by a still listener skip the direction, the attenuation callback and air absorption
+    if (settled && m_directPathValid && !m_distanceModel.dirty &&
+        m_directPathSourceGeneration == m_sourceGeneration && m_directPathListenerGeneration == m_listenerGeneration)
+    {
+        m_directPathHits.store(m_directPathHits.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+        return m_directPath;
+    }
+    m_directPathMisses.store(m_directPathMisses.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+
+    // Both already in LabSound/Steam Audio coords
+    const IPLVector3 sourceIPL = ToIPL(sourceMid);
+    const IPLVector3 listenerIPL = ToIPL(listenerMid.m_position);
+    m_directPath.m_direction = iplCalculateRelativeDirection(m_context, sourceIPL, listenerIPL, ToIPL(listenerMid.m_forward), ToIPL(listenerMid.m_up));
+
+    const float distanceAttenuation = iplDistanceAttenuationCalculate(m_context, ToIPL(sourceEnd), ToIPL(listenerEnd.m_position), &m_distanceModel);
+    m_distanceModel.dirty = IPL_FALSE;
 
     // Modify spatial blend and distance attenuation to allow them to interact properly
     // This prevents audio from cutting out abruptly when sources get very far away
     // Formula from Unity's Steam Audio implementation
-    float _distanceAttenuation = (1.0f - m_spatialBlend) + m_spatialBlend * distanceAttenuation;
-    float _spatialBlend = (m_spatialBlend == 1.0f && distanceAttenuation == 0.0f) ? 1.0f :
-                          m_spatialBlend * distanceAttenuation / _distanceAttenuation;
+    const float spatialBlend = m_renderParameters.m_spatialBlend;
+    m_directPath.m_distanceGain = (1.0f - spatialBlend) + spatialBlend * distanceAttenuation;
+    m_directPath.m_spatialBlend = (spatialBlend == 1.0f && distanceAttenuation == 0.0f) ? 1.0f :
+                                  spatialBlend * distanceAttenuation / m_directPath.m_distanceGain;
+
+    iplAirAbsorptionCalculate(m_context, sourceIPL, listenerIPL, &m_airAbsModel, m_directPath.m_airAbsorption);
+
+    // Only poses that stay put are worth keeping, a moving ramp needs fresh values next frame anyway
+    m_directPathValid = settled;
+    m_directPathSourceGeneration = m_sourceGeneration;
+    m_directPathListenerGeneration = m_listenerGeneration;
+    return m_directPath;
+}
 
-    IPLDirectEffectParams directParams{};
-    directParams.flags = static_cast<IPLDirectEffectFlags>(IPL_DIRECTEFFECTFLAGS_APPLYDISTANCEATTENUATION |
-        IPL_DIRECTEFFECTFLAGS_APPLYAIRABSORPTION);
-    directParams.distanceAttenuation = _distanceAttenuation;
-    iplAirAbsorptionCalculate(m_context, sourceIPL, listenerIPL, &m_airAbsModel, directParams.airAbsorption);
+void SteamAudioHrtfNode::ZeroBuffer(IPLAudioBuffer& buffer)
+{
+    for (int ch = 0; ch < buffer.numChannels; ++ch)
+    {
+        AZStd::fill(buffer.data[ch], buffer.data[ch] + buffer.numSamples, 0.0f);
+    }
+}
 
-    iplDirectEffectApply(m_directEffect, &directParams, &inBuffer, &m_directBuffer);
+void SteamAudioHrtfNode::ApplyGainRamp(IPLAudioBuffer& buffer, float from, float to)
+{
+    if (from == to)
+    {
+        if (from != 1.0f)
+        {
+            for (int ch = 0; ch < buffer.numChannels; ++ch)
+            {
+                float* data = buffer.data[ch];
+                for (int i = 0; i < buffer.numSamples; ++i)
+                {
+                    data[i] *= from;
+                }
+            }
+        }
+        return;
+    }
 
-    IPLBinauralEffectParams params{};
-    params.direction = direction;
-    params.interpolation = m_interpolation;
-    params.spatialBlend = _spatialBlend;
-    params.hrtf = m_hrtf;
-    params.peakDelays = nullptr;
-    iplBinauralEffectApply(m_binauralEffect, &params, &m_directBuffer, &outBuffer);
+    const float step = (to - from) / static_cast<float>(buffer.numSamples);
+    for (int ch = 0; ch < buffer.numChannels; ++ch)
+    {
+        float* data = buffer.data[ch];
+        float gain = from;
+        for (int i = 0; i < buffer.numSamples; ++i)
+        {
+            gain += step;
+            data[i] *= gain;
+        }
+    }
 }
 
 void SteamAudioHrtfNode::reset(lab::ContextRenderLock&)
 {
+    ResetRenderState();
+}
+
+void SteamAudioHrtfNode::ResetRenderState()
+{
+    // Whatever comes next starts where it is instead of sweeping from the old position
+    m_sourceRamp.Reset();
+    m_listenerRamp.Reset();
+    m_listenerGeneration = 0;
+    m_lastTransformTime = -1.0;
+    m_distanceGain = -1.0f;
+    m_unspatializedPanner.Reset();
+    m_directPathValid = false;
+    m_tierValid = false;
+    m_fadePosition = 0;
+    m_fadeLength = 0;
+    m_reblocker.Reset();
+
     if (m_binauralEffect)
     {
         iplBinauralEffectReset(m_binauralEffect);
     }
+
+    m_reflectionIdleSamples = 0;
+    if (m_reflectionState.load(AZStd::memory_order_acquire) == ReflectionState::Active)
+    {
+        iplReflectionEffectReset(m_reflectionEffect);
+        if (m_reflectionDecodeEffect)
+        {
+            iplAmbisonicsDecodeEffectReset(m_reflectionDecodeEffect);
+        }
+    }
 }
 
 void SteamAudioHrtfNode::setTransform(const AZ::Transform& transform)
 {
-    m_transform = transform;
+    m_gameParameters.m_transform = transform;
+    m_gameParameters.m_transformTime = AZStd::chrono::duration<double>(AZStd::chrono::steady_clock::now().time_since_epoch()).count();
+    PublishParameters();
+}
 
-    IPLSimulationInputs inputs = {};
-    inputs.flags = IPL_SIMULATIONFLAGS_REFLECTIONS;
-    inputs.source = ToIPL(m_transform);
-    inputs.numOcclusionSamples = 32;
-    inputs.numTransmissionRays = 32;
+void SteamAudioHrtfNode::setSpatialBlend(float blend)
+{
+    m_gameParameters.m_spatialBlend = blend;
+    PublishParameters();
+}
 
-    if (m_distanceModel.type == IPL_DISTANCEATTENUATIONTYPE_CALLBACK)
+void SteamAudioHrtfNode::setInterpolation(IPLHRTFInterpolation interp)
+{
+    m_gameParameters.m_interpolation = interp;
+    PublishParameters();
+}
+
+void SteamAudioHrtfNode::updateTuAttenuationSettings(const Attenuation::TuAttenuation& settings)
+{
+    m_gameParameters.m_attenuation = settings;
+    PublishParameters();
+}
+
+void SteamAudioHrtfNode::setDistanceAttenuation(float minDistance)
+{
+    m_gameParameters.m_distanceModelType = IPL_DISTANCEATTENUATIONTYPE_INVERSEDISTANCE;
+    m_gameParameters.m_minDistance = minDistance;
+    PublishParameters();
+}
+
+void SteamAudioHrtfNode::setDistanceModelType(IPLDistanceAttenuationModelType type)
+{
+    m_gameParameters.m_distanceModelType = type;
+    PublishParameters();
+}
+
+void SteamAudioHrtfNode::PublishParameters()
+{
+    m_parameters.Write(m_gameParameters);
+
+    if (!m_source)
     {
-        inputs.occlusionRadius = m_attenuation.m_innerRadius;
+        return;
+    }
+
+    const HrtfNodeParameters& parameters = m_gameParameters;
+
+    IPLSimulationInputs inputs = {};
+    inputs.flags = m_simulationSource.m_flags;
+    inputs.directFlags = static_cast<IPLDirectSimulationFlags>(IPL_DIRECTSIMULATIONFLAGS_OCCLUSION | IPL_DIRECTSIMULATIONFLAGS_TRANSMISSION);
+    inputs.source = ToIPL(parameters.m_transform);
+    // Same space as the listener and the scene geometry
+    const auto sourcePos = Sune::ToLab(parameters.m_transform.GetTranslation());
+    inputs.source.origin = IPLVector3{ sourcePos.x, sourcePos.y, sourcePos.z };
+    inputs.occlusionType = m_directSettings.m_occlusionType;
+    inputs.numOcclusionSamples = m_directSettings.m_numOcclusionSamples;
+    inputs.numTransmissionRays = m_directSettings.m_numTransmissionRays;
+
+    if (parameters.m_distanceModelType == IPL_DISTANCEATTENUATIONTYPE_CALLBACK)
+    {
+        inputs.occlusionRadius = parameters.m_attenuation.m_innerRadius;
     }else
     {
-        inputs.occlusionRadius = m_distanceModel.minDistance;
+        inputs.occlusionRadius = parameters.m_minDistance;
     }
 
-    inputs.distanceAttenuationModel = m_distanceModel;
+    // Distance attenuation is applied in process(), it is never simulated. Leaving the default model here
+    // keeps the simulation threads away from the callback and the render thread's attenuation settings.
+    inputs.distanceAttenuationModel = {};
+    inputs.distanceAttenuationModel.type = IPL_DISTANCEATTENUATIONTYPE_DEFAULT;
 
     inputs.airAbsorptionModel = m_airAbsModel;
 
-    iplSourceSetInputs(m_source, IPL_SIMULATIONFLAGS_REFLECTIONS, &inputs);
+    // Applied by the simulation threads right before they run, never while they are running
+    m_simulationSource.m_inputs.Write(inputs);
 }
 
-void SteamAudioHrtfNode::updateTuAttenuationSettings(const Attenuation::TuAttenuation& settings)
+void SteamAudioHrtfNode::ReceiveParameters()
 {
-    m_attenuation = settings;
+    if (!m_parameters.Read(m_renderParameters))
+    {
+        return;
+    }
+
+    // Only recompiled when the curve actually changed, most blocks just carry a new transform
+    m_attenuationTable.Build(m_renderParameters.m_attenuation);
+
+    if (m_renderParameters.m_transformTime != m_lastTransformTime)
+    {
+        const auto sourcePos = Sune::ToLab(m_renderParameters.m_transform.GetTranslation());
+        m_sourceRamp.Push(AZ::Vector3(sourcePos.x, sourcePos.y, sourcePos.z), m_renderParameters.m_transformTime);
+        ++m_sourceGeneration;
+        m_lastTransformTime = m_renderParameters.m_transformTime;
+    }
+
+    m_distanceModel.type = m_renderParameters.m_distanceModelType;
+    m_distanceModel.minDistance = m_renderParameters.m_minDistance;
+    if (m_distanceModel.type == IPL_DISTANCEATTENUATIONTYPE_CALLBACK)
+    {
+        // Points at the render thread's own copy, the game thread never touches it
+        m_distanceModel.callback = DistanceAttenuationCallback;
+        m_distanceModel.userData = &m_attenuationTable;
+    }
+    else
+    {
+        m_distanceModel.callback = nullptr;
+        m_distanceModel.userData = nullptr;
+    }
     m_distanceModel.dirty = IPL_TRUE;
-    setTransform(m_transform);
 }
 
-void SteamAudioHrtfNode::EnsureDirectEffectInitialized(int numChannels)
+void SteamAudioHrtfNode::CreateDirectLayouts(const IPLAudioSettings& audioSettings)
 {
-    // If channel count changed or effect not created yet, recreate the direct effect
-    if (m_lastInputChannelCount != numChannels || !m_directEffect)
+    for (int channels = 1; channels <= MaxDirectChannels; ++channels)
     {
-        IPLAudioSettings audioSettings = TuSteamAudioInterface::Get()->GetAudioSettings();
-
-        // Release old effect if it exists
-        if (m_directEffect)
-        {
-            iplDirectEffectRelease(&m_directEffect);
-            m_directEffect = nullptr;
-        }
+        DirectLayout& layout = m_directLayouts[channels - 1];
 
-        // Create new direct effect with correct channel count
         IPLDirectEffectSettings directEffectSettings{};
-        directEffectSettings.numChannels = numChannels;
-
-        IPLerror err = iplDirectEffectCreate(m_context, &audioSettings, &directEffectSettings, &m_directEffect);
+        directEffectSettings.numChannels = channels;
+        IPLerror err = iplDirectEffectCreate(m_context, &audioSettings, &directEffectSettings, &layout.m_effect);
         if (err != IPL_STATUS_SUCCESS)
         {
-            AZ_Error("SteamAudioHrtfNode", false, "Failed to create direct effect with %d channels", numChannels);
-            m_directEffect = nullptr;
+            AZ_Error("SteamAudioHrtfNode", false, "Failed to create direct effect with %d channels", channels);
+            layout.m_effect = nullptr;
+            continue;
         }
-        else
+        iplAudioBufferAllocate(m_context, channels, audioSettings.frameSize, &layout.m_buffer);
+    }
+    iplAudioBufferAllocate(m_context, 1, audioSettings.frameSize, &m_downmixBuffer);
+}
+
+void SteamAudioHrtfNode::ReleaseDirectLayouts()
+{
+    for (DirectLayout& layout : m_directLayouts)
+    {
+        if (layout.m_effect)
         {
-            m_lastInputChannelCount = numChannels;
+            iplDirectEffectRelease(&layout.m_effect);
+            layout.m_effect = nullptr;
+            iplAudioBufferFree(m_context, &layout.m_buffer);
+            layout.m_buffer = {};
         }
     }
+    if (m_downmixBuffer.numChannels > 0)
+    {
+        iplAudioBufferFree(m_context, &m_downmixBuffer);
+        m_downmixBuffer = {};
+    }
+
+    m_directEffect = nullptr;
+    m_directBuffer = {};
+    m_directChannels = 0;
 }
 
-void SteamAudioHrtfNode::UpdateBuffers(int inputChannelCount, int outputChannelCount, int sampleCount)
+void SteamAudioHrtfNode::SelectDirectLayout(int numChannels)
 {
-    if (m_directBuffer.numChannels != inputChannelCount || m_directBuffer.numSamples != sampleCount)
+    if (numChannels == m_directChannels)
+    {
+        return;
+    }
+
+    const DirectLayout& layout = m_directLayouts[AZ::GetClamp(numChannels, 1, MaxDirectChannels) - 1];
+    m_directEffect = layout.m_effect;
+    m_directBuffer = layout.m_buffer;
+    m_directChannels = numChannels;
+
+    // The filters still hold whatever this layout played last time it was used
+    if (m_directEffect)
     {
-        iplAudioBufferFree(m_context, &m_directBuffer);
-        iplAudioBufferAllocate(m_context, inputChannelCount, sampleCount, &m_directBuffer);
+        iplDirectEffectReset(m_directEffect);
     }
 }
 
@@ -331,14 +1317,23 @@ double SteamAudioHrtfNode::tailTime(lab::ContextRenderLock& r) const
     {
         tailSamples = AZStd::max(tailSamples, iplDirectEffectGetTailSize(m_directEffect));
     }
+    if (m_reflectionState.load(AZStd::memory_order_acquire) == ReflectionState::Active && m_reflectionDecodeEffect)
+    {
+        // With the shared mixer the tail rings out on SteamAudioReflectionMixerNode instead
+        tailSamples = AZStd::max(tailSamples, iplReflectionEffectGetTailSize(m_reflectionEffect));
+    }
 
     return static_cast<double>(tailSamples) / r.context()->sampleRate();
 }
 
+double SteamAudioHrtfNode::latencyTime(lab::ContextRenderLock& r) const
+{
+    return static_cast<double>(m_reblocker.GetLatency()) / r.context()->sampleRate();
+}
+
 float SteamAudioHrtfNode::DistanceAttenuationCallback(IPLfloat32 distance, void* userData)
 {
-    auto* settings = static_cast<Attenuation::TuAttenuation*>(userData);
-    return settings->CalculateAttenuation(distance);
+    return static_cast<const Attenuation::AttenuationTable*>(userData)->Lookup(distance);
 }
 
 SteamAudioHrtf::~SteamAudioHrtf()
@@ -348,21 +1343,69 @@ SteamAudioHrtf::~SteamAudioHrtf()
 
 bool SteamAudioHrtf::Initialize(lab::AudioContext& ac)
 {
-    m_node = std::make_shared<SteamAudioHrtfNode>(ac);
+    // Before Ready there is no pool, the node is upgraded like any other then
+    if (SpatializerPool* pool = TuSteamAudioInterface::Get()->GetSpatializerPool())
+    {
+        m_node = pool->Acquire(ac);
+    }
+    else
+    {
+        m_node = std::make_shared<SteamAudioHrtfNode>(ac);
+    }
+    ConnectReflectionMixer();
 
     // Connect to spatialization bus
     Sune::PlayerEffectSpatializationRequestBus::Handler::BusConnect(GetId());
     Sune::PlayerEffectImGuiRequestBus::Handler::BusConnect(GetId());
     SteamAudioEffectRequestBus::Handler::BusConnect(GetId());
+    TuSteamAudioNotificationBus::Handler::BusConnect();
 
     return m_node != nullptr;
 }
 
+void SteamAudioHrtf::ConnectReflectionMixer()
+{
+    if (!m_node->m_reflectionMixer || m_reflectionMixerNode)
+    {
+        return;
+    }
+
+    m_reflectionMixerNode = TuSteamAudioInterface::Get()->GetReflectionMixer();
+    if (auto labContext = Sune::SuneInterface::Get()->GetLabContext(); labContext && m_reflectionMixerNode)
+    {
+        labContext->connect(m_reflectionMixerNode, m_node);
+    }
+}
+
+void SteamAudioHrtf::OnReadinessChanged(SystemReadiness readiness)
+{
+    // Created while the system was initializing, the node has been panning plainly so far
+    if (readiness == SystemReadiness::Ready && m_node && m_node->upgradeSpatializer())
+    {
+        ConnectReflectionMixer();
+    }
+}
+
 void SteamAudioHrtf::Shutdown()
 {
+    TuSteamAudioNotificationBus::Handler::BusDisconnect();
     SteamAudioEffectRequestBus::Handler::BusDisconnect();
     Sune::PlayerEffectImGuiRequestBus::Handler::BusDisconnect();
     Sune::PlayerEffectSpatializationRequestBus::Handler::BusDisconnect();
+
+    if (m_reflectionMixerNode)
+    {
+        if (auto labContext = Sune::SuneInterface::Get()->GetLabContext())
+        {
+            labContext->disconnect(m_reflectionMixerNode, m_node);
+        }
+        m_reflectionMixerNode = nullptr;
+    }
+
+    if (SpatializerPool* pool = TuSteamAudioInterface::Get()->GetSpatializerPool(); pool && m_node)
+    {
+        pool->Release(AZStd::move(m_node));
+    }
     m_node = nullptr;
 }
 
@@ -394,10 +1437,10 @@ void SteamAudioHrtf::SetDistanceModel(DistanceModel model)
 
     if (model == DistanceModel::Default)
     {
-        m_node->m_distanceModel.type = IPL_DISTANCEATTENUATIONTYPE_DEFAULT;
+        m_node->setDistanceModelType(IPL_DISTANCEATTENUATIONTYPE_DEFAULT);
     }else
     {
-        m_node->m_distanceModel.type = IPL_DISTANCEATTENUATIONTYPE_INVERSEDISTANCE;
+        m_node->setDistanceModelType(IPL_DISTANCEATTENUATIONTYPE_INVERSEDISTANCE);
     }
 }
 
@@ -411,6 +1454,9 @@ void SteamAudioHrtf::DrawGui()
     if (!m_node)
         return;
 
+    // Edits go through the node's setters, which publish them to the render thread
+    const HrtfNodeParameters& parameters = m_node->getParameters();
+
     ImGui::Spacing();
     ImGui::TextColored(ImVec4(0.3f, 1.0f, 0.5f, 1.0f), "Steam Audio HRTF Spatialization:");
 
@@ -418,26 +1464,17 @@ void SteamAudioHrtf::DrawGui()
     ImGui::Separator();
     ImGui::TextColored(ImVec4(0.5f, 0.8f, 1.0f, 1.0f), "Position Minimap (Top-Down):");
 
-    // Get listener position from the audio context
-    auto ac = Sune::SuneInterface::Get()->GetLabContext();
-    if (ac)
+    // Listener as the render thread last captured it
+    ListenerState listener;
+    if (m_node->m_listenerCache && m_node->m_listenerCache->Read(listener))
     {
-        auto listener = ac->listener();
-        IPLVector3 listenerIPL = {
-            static_cast<float>(listener->positionX()->value()),
-            static_cast<float>(listener->positionY()->value()),
-            static_cast<float>(listener->positionZ()->value())
-        };
+        IPLVector3 listenerIPL = listener.m_coords.origin;
 
         // Get listener orientation (forward direction for rotation)
-        IPLVector3 forwardIPL = {
-            static_cast<float>(listener->forwardX()->value()),
-            static_cast<float>(listener->forwardY()->value()),
-            static_cast<float>(listener->forwardZ()->value())
-        };
+        IPLVector3 forwardIPL = listener.m_coords.ahead;
 
         // Convert source position to IPL coords
-        auto sourcePos = Sune::ToLab(m_node->m_transform.GetTranslation());
+        auto sourcePos = Sune::ToLab(parameters.m_transform.GetTranslation());
         IPLVector3 sourceIPL = { sourcePos.x, sourcePos.y, sourcePos.z };
 
         // Calculate distance
@@ -560,10 +1597,39 @@ void SteamAudioHrtf::DrawGui()
         ImGui::TextColored(ImVec4(1.0f, 0.3f, 0.3f, 1.0f), "Audio context not available");
     }
 
+    // How often process() could skip recomputing direction, attenuation and air absorption
+    const AZ::u64 cacheHits = m_node->getDirectPathCacheHits();
+    const AZ::u64 cacheTotal = cacheHits + m_node->getDirectPathCacheMisses();
+    ImGui::Text("Direct path cache: %llu / %llu frames (%.1f%%)",
+        static_cast<unsigned long long>(cacheHits), static_cast<unsigned long long>(cacheTotal),
+        cacheTotal > 0 ? 100.0 * static_cast<double>(cacheHits) / static_cast<double>(cacheTotal) : 0.0);
+
+    ImGui::Text("Reflection state: %.1f KB", static_cast<double>(m_node->getReflectionStateBytes()) / 1024.0);
+
+    if (AudibilityManager* audibility = TuSteamAudioInterface::Get()->GetAudibilityManager())
+    {
+        const char* tierNames[] = { "Virtual", "Stereo Pan", "Panning", "Full" };
+        ImGui::Text("Audibility tier: %s", tierNames[static_cast<int>(m_node->getAudibilityTier())]);
+        ImGui::Text("Listener voices: %u full, %u panning, %u virtual (%.3f ms per full voice)",
+            audibility->GetTierCount(AudibilityTier::Full), audibility->GetTierCount(AudibilityTier::Panning),
+            audibility->GetTierCount(AudibilityTier::Virtual), audibility->GetFullCost() * 1000.0);
+    }
+
+    if (QualityController* quality = TuSteamAudioInterface::Get()->GetQualityController())
+    {
+        const char* qualityNames[] = { "Bilinear HRTF", "Nearest HRTF", "Panning", "Stereo Pan" };
+        ImGui::Text("Spatial quality: %s (%.0f%% of each quantum, budget %.0f%%)",
+            qualityNames[static_cast<int>(quality->GetQuality())], quality->GetLoad() * 100.0f, quality->GetSettings().m_budget * 100.0f);
+        if (quality->GetQuality() != SpatialQuality::Bilinear && ImGui::IsItemHovered())
+        {
+            ImGui::SetTooltip("Lowered to stay inside the audio CPU budget, HRTF Interpolation below is overridden");
+        }
+    }
+
     ImGui::Separator();
 
     // HRTF Interpolation
-    int interpIndex = m_node->m_interpolation;
+    int interpIndex = parameters.m_interpolation;
     const char* interpModes[] = { "Nearest", "Bilinear" };
     if (ImGui::Combo("HRTF Interpolation", &interpIndex, interpModes, IM_ARRAYSIZE(interpModes)))
     {
@@ -571,7 +1637,7 @@ void SteamAudioHrtf::DrawGui()
     }
 
     // Spatial Blend
-    float spatialBlend = m_node->m_spatialBlend;
+    float spatialBlend = parameters.m_spatialBlend;
     if (ImGui::SliderFloat("Spatial Blend", &spatialBlend, 0.0f, 1.0f))
     {
         m_node->setSpatialBlend(spatialBlend);
@@ -585,7 +1651,7 @@ void SteamAudioHrtf::DrawGui()
     ImGui::TextColored(ImVec4(0.8f, 0.8f, 0.3f, 1.0f), "Distance Attenuation:");
 
     // Distance attenuation model
-    int distModelIndex = m_node->m_distanceModel.type;
+    int distModelIndex = parameters.m_distanceModelType;
     const char* distModels[] = { "Default (Inverse)", "Inverse Distance", "TuAttenuation" };
     if (ImGui::Combo("Attenuation Model", &distModelIndex, distModels, IM_ARRAYSIZE(distModels)))
     {
@@ -594,31 +1660,34 @@ void SteamAudioHrtf::DrawGui()
             m_node->useTuAttenuation();
         }else
         {
-            m_node->m_distanceModel.type = static_cast<IPLDistanceAttenuationModelType>(distModelIndex);
+            m_node->setDistanceModelType(static_cast<IPLDistanceAttenuationModelType>(distModelIndex));
         }
     }
 
-    if (m_node->m_distanceModel.type == IPL_DISTANCEATTENUATIONTYPE_CALLBACK)
+    if (parameters.m_distanceModelType == IPL_DISTANCEATTENUATIONTYPE_CALLBACK)
     {
+        Attenuation::TuAttenuation tuAttenuation = parameters.m_attenuation;
+        bool attenuationChanged = false;
+
         // Using Attenuation::TuAttenuation - expose all parameters
         ImGui::Separator();
         ImGui::TextColored(ImVec4(0.5f, 1.0f, 0.8f, 1.0f), "TuAttenuation Settings:");
 
         // Shape selector (currently only Sphere is available)
-        int shapeIndex = static_cast<int>(m_node->m_attenuation.m_shape);
+        int shapeIndex = static_cast<int>(tuAttenuation.m_shape);
         const char* shapes[] = { "Sphere" };
         if (ImGui::Combo("Attenuation Shape", &shapeIndex, shapes, IM_ARRAYSIZE(shapes)))
         {
-            m_node->m_attenuation.m_shape = static_cast<Attenuation::Shape>(shapeIndex);
-            m_node->m_distanceModel.dirty = IPL_TRUE;
+            tuAttenuation.m_shape = static_cast<Attenuation::Shape>(shapeIndex);
+            attenuationChanged = true;
         }
 
         // Inner Radius
-        float innerRadius = m_node->m_attenuation.m_innerRadius;
+        float innerRadius = tuAttenuation.m_innerRadius;
         if (ImGui::DragFloat("Inner Radius", &innerRadius, 0.1f, 0.0f, 1000.0f, "%.1f m"))
         {
-            m_node->m_attenuation.m_innerRadius = innerRadius;
-            m_node->m_distanceModel.dirty = IPL_TRUE;
+            tuAttenuation.m_innerRadius = innerRadius;
+            attenuationChanged = true;
         }
         if (ImGui::IsItemHovered())
         {
@@ -626,11 +1695,11 @@ void SteamAudioHrtf::DrawGui()
         }
 
         // Falloff Distance
-        float falloffDistance = m_node->m_attenuation.m_falloffDistance;
+        float falloffDistance = tuAttenuation.m_falloffDistance;
         if (ImGui::DragFloat("Falloff Distance", &falloffDistance, 1.0f, 0.1f, 10000.0f, "%.1f m"))
         {
-            m_node->m_attenuation.m_falloffDistance = AZ::GetMax(falloffDistance, 0.1f);
-            m_node->m_distanceModel.dirty = IPL_TRUE;
+            tuAttenuation.m_falloffDistance = AZ::GetMax(falloffDistance, 0.1f);
+            attenuationChanged = true;
         }
         if (ImGui::IsItemHovered())
         {
@@ -638,12 +1707,12 @@ void SteamAudioHrtf::DrawGui()
         }
 
         // Curve Type
-        int curveIndex = static_cast<int>(m_node->m_attenuation.m_curveType);
+        int curveIndex = static_cast<int>(tuAttenuation.m_curveType);
         const char* curveTypes[] = { "Linear", "Logarithmic", "Inverse", "Log Reverse", "Natural Sound (1/d²)" };
         if (ImGui::Combo("Attenuation Curve", &curveIndex, curveTypes, IM_ARRAYSIZE(curveTypes)))
         {
-            m_node->m_attenuation.m_curveType = static_cast<Attenuation::TuAttenuation::CurveType>(curveIndex);
-            m_node->m_distanceModel.dirty = IPL_TRUE;
+            tuAttenuation.m_curveType = static_cast<Attenuation::TuAttenuation::CurveType>(curveIndex);
+            attenuationChanged = true;
         }
         if (ImGui::IsItemHovered())
         {
@@ -658,18 +1727,24 @@ void SteamAudioHrtf::DrawGui()
         }
 
         // Attenuation Curve Exponent (for future custom curve use)
-        float exponent = m_node->m_attenuation.m_attenuationCurveExponent;
+        float exponent = tuAttenuation.m_attenuationCurveExponent;
         if (ImGui::DragFloat("Curve Exponent", &exponent, 0.01f, 0.1f, 10.0f, "%.2f"))
         {
-            m_node->m_attenuation.m_attenuationCurveExponent = AZ::GetClamp(exponent, 0.1f, 10.0f);
-            m_node->m_distanceModel.dirty = IPL_TRUE;
+            tuAttenuation.m_attenuationCurveExponent = AZ::GetClamp(exponent, 0.1f, 10.0f);
+            attenuationChanged = true;
         }
         if (ImGui::IsItemHovered())
         {
             ImGui::SetTooltip("Controls curve steepness (reserved for future use)");
         }
 
+        if (attenuationChanged)
+        {
+            m_node->updateTuAttenuationSettings(tuAttenuation);
+        }
+
         // Visual preview of the attenuation curve
+        m_previewTable.Build(tuAttenuation);
         ImGui::Separator();
         ImGui::TextColored(ImVec4(0.7f, 0.9f, 1.0f, 1.0f), "Attenuation Preview:");
 
@@ -705,48 +1780,14 @@ void SteamAudioHrtf::DrawGui()
         for (int i = 0; i <= numPoints; ++i)
         {
             float t = static_cast<float>(i) / numPoints;
-            float distance = m_node->m_attenuation.m_innerRadius +
-                           (m_node->m_attenuation.m_falloffDistance * t);
+            float distance = tuAttenuation.m_innerRadius +
+                           (tuAttenuation.m_falloffDistance * t);
 
-            // Calculate attenuation using the callback (simulated)
-            float attenuation = 1.0f;
-            if (distance > m_node->m_attenuation.m_innerRadius)
-            {
-                float effectiveDist = distance - m_node->m_attenuation.m_innerRadius;
-                float normalizedDist = effectiveDist / m_node->m_attenuation.m_falloffDistance;
-
-                if (normalizedDist >= 1.0f)
-                {
-                    attenuation = 0.0f;
-                }
-                else
-                {
-                    switch (m_node->m_attenuation.m_curveType)
-                    {
-                        case Attenuation::TuAttenuation::CurveType::Linear:
-                            attenuation = 1.0f - normalizedDist;
-                            break;
-                        case Attenuation::TuAttenuation::CurveType::Logarithmic:
-                            attenuation = 1.0f - (std::log(normalizedDist * 9.0f + 1.0f) / std::log(10.0f));
-                            break;
-                        case Attenuation::TuAttenuation::CurveType::Inverse:
-                            attenuation = m_node->m_attenuation.m_innerRadius / distance;
-                            break;
-                        case Attenuation::TuAttenuation::CurveType::NaturalSound:
-                            {
-                                float ratio = m_node->m_attenuation.m_innerRadius / distance;
-                                attenuation = ratio * ratio;
-                            }
-                            break;
-                        case Attenuation::TuAttenuation::CurveType::LogReverse:
-                            attenuation = std::log((1.0f - normalizedDist) * 9.0f + 1.0f) / std::log(10.0f);
-                            break;
-                    }
-                }
-            }
+            // Same table the node renders with
+            float gain = m_previewTable.Lookup(distance);
 
             float x = graphPos.x + (t * graphWidth);
-            float y = graphPos.y + graphHeight - (attenuation * graphHeight);
+            float y = graphPos.y + graphHeight - (gain * graphHeight);
 
             ImVec2 point(x, y);
             if (i > 0)
@@ -763,21 +1804,21 @@ void SteamAudioHrtf::DrawGui()
             IM_COL32(200, 200, 200, 255), "0.0");
 
         char distLabel[64];
-        snprintf(distLabel, sizeof(distLabel), "%.0fm", m_node->m_attenuation.m_innerRadius);
+        snprintf(distLabel, sizeof(distLabel), "%.0fm", tuAttenuation.m_innerRadius);
         drawList->AddText(ImVec2(graphPos.x + 5, graphPos.y + graphHeight + 5),
             IM_COL32(200, 200, 200, 255), distLabel);
 
         snprintf(distLabel, sizeof(distLabel), "%.0fm",
-            m_node->m_attenuation.m_innerRadius + m_node->m_attenuation.m_falloffDistance);
+            tuAttenuation.m_innerRadius + tuAttenuation.m_falloffDistance);
         drawList->AddText(ImVec2(graphPos.x + graphWidth - 40, graphPos.y + graphHeight + 5),
             IM_COL32(200, 200, 200, 255), distLabel);
 
         ImGui::Dummy(ImVec2(graphWidth, graphHeight + 25));
     }
-    else if (m_node->m_distanceModel.type == IPL_DISTANCEATTENUATIONTYPE_INVERSEDISTANCE)
+    else if (parameters.m_distanceModelType == IPL_DISTANCEATTENUATIONTYPE_INVERSEDISTANCE)
     {
         // Min Distance for inverse distance model
-        float minDistance = m_node->m_distanceModel.minDistance;
+        float minDistance = parameters.m_minDistance;
         if (ImGui::DragFloat("Min Distance", &minDistance, 0.1f, 0.1f, 100.0f))
         {
             if (m_node)
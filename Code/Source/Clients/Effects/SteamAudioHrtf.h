@@ -8,16 +8,62 @@
 
 #include "Sune/PlayerAudioEffect.h"
 #include "TuSteamAudio/Types.h"
+#include "TuSteamAudio/AttenuationTable.h"
 #include "phonon.h"
 #include <AzCore/Math/Vector3.h>
 
 #include "AzCore/Math/Transform.h"
 #include "TuSteamAudio/TuSteamAudioBus.h"
+#include "Clients/Simulation/SimulationManager.h"
+#include "Clients/Hrtf/HrtfSwap.h"
+#include "TripleBuffer.h"
+#include "PoseRamp.h"
+#include "ListenerCache.h"
+#include "AudibilityManager.h"
+#include "QualityController.h"
+#include "ReblockingFifo.h"
+#include "UnspatializedPanner.h"
 
 
 namespace TuSteamAudio
 {
-    class SteamAudioHrtfNode : public lab::AudioNode
+    //! Everything the game side controls about a SteamAudioHrtfNode, handed to the render thread as one block.
+    struct HrtfNodeParameters
+    {
+        AZ::Transform m_transform = AZ::Transform::Identity();
+        //! Game clock seconds when m_transform was set, the render thread ramps over the gaps between them.
+        double m_transformTime = 0.0;
+        IPLHRTFInterpolation m_interpolation = IPL_HRTFINTERPOLATION_BILINEAR;
+        float m_spatialBlend = 1.0f;
+        IPLDistanceAttenuationModelType m_distanceModelType = IPL_DISTANCEATTENUATIONTYPE_INVERSEDISTANCE;
+        float m_minDistance = 1.0f;
+        Attenuation::TuAttenuation m_attenuation = {};
+    };
+
+    //! Per frame values derived from the source and listener poses.
+    struct HrtfDirectPath
+    {
+        IPLVector3 m_direction = { 0.0f, 0.0f, -1.0f };
+        //! Distance attenuation after the spatial blend was folded in, ramped towards every frame.
+        float m_distanceGain = 1.0f;
+        float m_spatialBlend = 1.0f;
+        float m_airAbsorption[3] = { 1.0f, 1.0f, 1.0f };
+    };
+
+    //! Who may touch a node's reflection effect, which only exists while the source actually gets reflections.
+    enum class ReflectionState : AZ::u8
+    {
+        Released,  // No effect, the game thread creates one once it is Requested
+        Requested, // Set by the render thread, the simulation has an IR for a source without an effect
+        Active,    // Set by the game thread, the render thread owns the effect
+        Idle       // Set by the render thread, nothing was convolved for a while and the game thread may release it
+    };
+
+    //! Setters are game thread only. They edit a game side copy of the parameters and publish it whole,
+    //! process() picks up the newest block once per quantum without locking.
+    class SteamAudioHrtfNode
+        : public lab::AudioNode
+        , public HrtfClient
     {
     public:
         SteamAudioHrtfNode(lab::AudioContext& ac);
@@ -27,65 +73,232 @@ namespace TuSteamAudio
         const char* name() const override{ return static_name(); }
         static lab::AudioNodeDescriptor* desc();
 
+        //! Only creates the Steam Audio side once the system is Ready, until then process() pans the input plainly.
         void initialize() override;
         void uninitialize() override;
+        //! Game thread, creates the Steam Audio side of a node initialized before the system was Ready.
+        //! Returns whether the node now spatializes.
+        bool upgradeSpatializer();
+        //! Whether the Steam Audio side exists.
+        bool isSpatialized() const { return m_spatializerReady.load(AZStd::memory_order_acquire); }
+
+        //! Game thread, for SpatializerPool. Parking takes an idle node out of the audibility ranking and the
+        //! simulator, recycling puts it back with the default parameters and has process() drop what it rendered before.
+        void park();
+        void recycle();
 
+        //! Renders through the reblocker whenever LabSound's quantum and Steam Audio's frame don't line up.
         void process(lab::ContextRenderLock&, int bufferSize) override;
         void reset(lab::ContextRenderLock&) override;
 
         void setTransform(const AZ::Transform& transform);
-        void setSpatialBlend(float blend) { m_spatialBlend = blend; }
-        void setInterpolation(IPLHRTFInterpolation interp) { m_interpolation = interp; }
+        void setSpatialBlend(float blend);
+        void setInterpolation(IPLHRTFInterpolation interp);
         void updateTuAttenuationSettings(const Attenuation::TuAttenuation& settings);
 
         // Distance attenuation settings
-        void setDistanceAttenuation(float minDistance)
-        {
-            m_distanceModel.type = IPL_DISTANCEATTENUATIONTYPE_INVERSEDISTANCE;
-            m_distanceModel.minDistance = minDistance;
-        }
+        void setDistanceAttenuation(float minDistance);
+        void setDistanceModelType(IPLDistanceAttenuationModelType type);
+        void useTuAttenuation() { setDistanceModelType(IPL_DISTANCEATTENUATIONTYPE_CALLBACK); }
 
-        void useTuAttenuation()
-        {
-            m_distanceModel.type = IPL_DISTANCEATTENUATIONTYPE_CALLBACK;
-            m_distanceModel.callback = DistanceAttenuationCallback;
-            m_distanceModel.userData = &m_attenuation;
-            m_distanceModel.dirty = IPL_TRUE;
-        }
+        //! Game thread view of the parameters, what the render thread gets on its next quantum.
+        const HrtfNodeParameters& getParameters() const { return m_gameParameters; }
+
+        //! Frames that reused the derived direct path parameters, and frames that had to compute them.
+        AZ::u64 getDirectPathCacheHits() const { return m_directPathHits.load(AZStd::memory_order_relaxed); }
+        AZ::u64 getDirectPathCacheMisses() const { return m_directPathMisses.load(AZStd::memory_order_relaxed); }
+
+        //! Game thread. What the reflection effect of this source holds, 0 while it has none.
+        AZ::u64 getReflectionStateBytes() const { return m_reflectionStateBytes; }
+
+        //! Tier the audibility manager last gave this voice.
+        AudibilityTier getAudibilityTier() const { return m_audibility ? m_audibility->GetTier(m_voice) : AudibilityTier::Full; }
+
+        // HrtfClient
+        void UpdateHrtf(IPLHRTF hrtf) override;
 
     protected:
-        void UpdateBuffers(int inputChannelCount, int outputChannelCount, int sampleCount);
-        void EnsureDirectEffectInitialized(int numChannels);
+        //! Game thread, everything Phonon the node holds.
+        void CreateSpatializer();
+        void ReleaseSpatializer();
+        //! Render thread, forgets the ramps, tiers, reblocked frames and effect tails of whatever played before.
+        void ResetRenderState();
+        //! Render thread, what the node renders until the Steam Audio side exists.
+        void RenderUnspatialized(lab::ContextRenderLock& r, lab::AudioBus& inputBus, lab::AudioBus& outputBus, int bufferSize);
+        //! Game thread, creates the direct effect and buffer of every supported input layout.
+        void CreateDirectLayouts(const IPLAudioSettings& audioSettings);
+        void ReleaseDirectLayouts();
+        //! Render thread. Points m_directEffect and m_directBuffer at the prepared layout, never allocates.
+        void SelectDirectLayout(int numChannels);
+        //! Render thread. Everything Steam Audio does for one frame of input, in and out are frameSize long.
+        void RenderFrame(lab::ContextRenderLock& r, IPLAudioBuffer& inBuffer, IPLAudioBuffer& outBuffer);
+        void ApplyReflections(IPLAudioBuffer& inBuffer, IPLAudioBuffer& outBuffer, const IPLCoordinateSpace3& listener);
+        //! Direction, distance gain and air absorption for this frame, reused while nothing they depend on changed.
+        const HrtfDirectPath& UpdateDirectPath(const AZ::Vector3& sourceMid, const AZ::Vector3& sourceEnd,
+            const ListenerPose& listenerMid, const ListenerPose& listenerEnd, bool settled);
+        //! Asks the audibility manager for this frame's tier and starts a crossfade when it changed.
+        void UpdateAudibilityTier(lab::ContextRenderLock& r, float audibility);
+        //! Renders m_directBuffer at one tier into a stereo buffer.
+        void RenderTier(AudibilityTier tier, const HrtfDirectPath& path, IPLAudioBuffer& inBuffer, IPLAudioBuffer& outBuffer,
+            const ListenerPose& listenerMid);
+        //! Steam Audio's panning effect, or a constant power pan of our own for StereoPan.
+        void RenderPanning(const HrtfDirectPath& path, IPLAudioBuffer& outBuffer, bool stereoPan);
+        //! Fades outBuffer in over m_fadeBuffer, which holds the tier being left.
+        void ApplyCrossfade(IPLAudioBuffer& outBuffer);
+        //! Game thread, on the HRTF tick. Creates the reflection effect asked for, releases one that went Idle.
+        void UpdateReflectionState();
+        bool CreateReflectionEffect();
+        void ReleaseReflectionEffect();
+        //! Render thread, gives the reflection effect up once it went unused for the idle release time.
+        void AdvanceReflectionIdle(int numSamples);
+        //! Render thread, takes the effects offered for a new HRTF and starts the crossfade to them.
+        void BeginHrtfSwap();
+        void AdvanceHrtfSwap(int numSamples);
+        //! Game thread, releases an offer that was withdrawn or the effects faded away from.
+        static void ReleaseHrtfEffects(IPLHRTF& hrtf, IPLBinauralEffect& binauralEffect, IPLAmbisonicsDecodeEffect& decodeEffect);
+        static void ZeroBuffer(IPLAudioBuffer& buffer);
+        //! Scales every channel by a straight line from one gain to the other across the buffer.
+        static void ApplyGainRamp(IPLAudioBuffer& buffer, float from, float to);
         double tailTime(lab::ContextRenderLock& r) const override;
-        double latencyTime(lab::ContextRenderLock& r) const override { return 0; }
+        //! How far the reblocker holds the output back, 0 while frames and quanta line up.
+        double latencyTime(lab::ContextRenderLock& r) const override;
 
         static float IPLCALL DistanceAttenuationCallback(IPLfloat32 distance, void* userData);
 
     private:
         friend class SteamAudioHrtf;
-        //Settings
-        AZ::Transform m_transform = AZ::Transform::Identity();
-        IPLHRTFInterpolation m_interpolation = IPL_HRTFINTERPOLATION_BILINEAR;
-        Attenuation::TuAttenuation m_attenuation = {};
-        float m_spatialBlend = 1.0f;
+        //! Game thread, hands the parameters to the render thread and the simulation.
+        void PublishParameters();
+        //! Render thread, takes the newest published parameters if there are any.
+        void ReceiveParameters();
+
+        //Settings, each thread has its own copy
+        HrtfNodeParameters m_gameParameters;
+        HrtfNodeParameters m_renderParameters;
+        TripleBuffer<HrtfNodeParameters> m_parameters;
+        //Render thread, compiled from m_renderParameters.m_attenuation
+        Attenuation::AttenuationTable m_attenuationTable;
+
+        //Render thread motion, transforms arrive at the game's rate and are eased across quanta
+        PoseRamp<AZ::Vector3> m_sourceRamp;
+        PoseRamp<ListenerPose> m_listenerRamp;
+        AZ::u64 m_listenerGeneration = 0;
+        AZ::u64 m_sourceGeneration = 0;
+
+        //Derived direct path, valid for the generations below while both ramps are settled and the model isn't dirty
+        HrtfDirectPath m_directPath;
+        AZ::u64 m_directPathSourceGeneration = 0;
+        AZ::u64 m_directPathListenerGeneration = 0;
+        bool m_directPathValid = false;
+        AZStd::atomic<AZ::u64> m_directPathHits{ 0 };
+        AZStd::atomic<AZ::u64> m_directPathMisses{ 0 };
+        double m_lastTransformTime = -1.0;
+        //Distance gain the last quantum ended on, negative until the first one
+        float m_distanceGain = -1.0f;
+
+        //Audibility LOD, the tier this voice renders at and the one it is fading away from
+        AudibilityManager* m_audibility = nullptr;
+        QualityController* m_qualityController = nullptr;
+        AudibilityVoiceId m_voice = InvalidAudibilityVoiceId;
+        AudibilityTier m_tier = AudibilityTier::Full;
+        AudibilityTier m_fadeFromTier = AudibilityTier::Full;
+        bool m_tierValid = false;
+        //Samples into the running crossfade, there is none once it reaches the length
+        int m_fadePosition = 0;
+        int m_fadeLength = 0;
 
         //Globals retained
         IPLContext m_context = nullptr;
         IPLHRTF m_hrtf = nullptr;
         IPLScene m_scene = nullptr;
         IPLSimulator m_simulator = nullptr;
+        ListenerCache* m_listenerCache = nullptr;
 
         //Per instance handles
         IPLSource m_source = {};
+        //! The selected layout's buffer, owned by m_directLayouts
         IPLAudioBuffer m_directBuffer = {};
 
         //Effects
+        //! The selected layout's effect, owned by m_directLayouts
         IPLDirectEffect m_directEffect = {};
+        //Direct effect and output buffer per input channel count, index 0 is mono
+        struct DirectLayout
+        {
+            IPLDirectEffect m_effect = nullptr;
+            IPLAudioBuffer m_buffer = {};
+        };
+        static constexpr int MaxDirectChannels = 2;
+        AZStd::array<DirectLayout, MaxDirectChannels> m_directLayouts;
+        //Wider inputs are downmixed into this and take the mono layout
+        IPLAudioBuffer m_downmixBuffer = {};
         IPLBinauralEffect m_binauralEffect = {};
+        //Panning tier, mono in and stereo out
+        IPLPanningEffect m_panningEffect = nullptr;
+        IPLAudioBuffer m_panningBuffer = {};
+        //Tier being faded out
+        IPLAudioBuffer m_fadeBuffer = {};
+        //! Created by the game thread on request, the render thread only uses it while m_reflectionState is Active
         IPLReflectionEffect m_reflectionEffect = {};
+        //Per node decode, only used without the shared reflection mixer. Created along with the effect
+        IPLAmbisonicsDecodeEffect m_reflectionDecodeEffect = {};
+        IPLReflectionMixer m_reflectionMixer = nullptr;
+
+        //HRTF swap, next is written by the game thread while Idle, fade released by it once Retired
+        AZStd::atomic<HrtfSwapState> m_hrtfSwapState{ HrtfSwapState::Idle };
+        //! Game thread, the HRTF last offered. Only compared, never dereferenced.
+        IPLHRTF m_gameHrtf = nullptr;
+        IPLHRTF m_nextHrtf = nullptr;
+        IPLBinauralEffect m_nextBinauralEffect = nullptr;
+        IPLAmbisonicsDecodeEffect m_nextReflectionDecodeEffect = nullptr;
+        IPLHRTF m_fadeHrtf = nullptr;
+        IPLBinauralEffect m_fadeBinauralEffect = nullptr;
+        IPLAmbisonicsDecodeEffect m_fadeReflectionDecodeEffect = nullptr;
+        //Render thread, what the effects bound to the old HRTF render while they fade out
+        IPLAudioBuffer m_hrtfFadeBuffer = {};
+        HrtfCrossfade m_hrtfFade;
+
+        //Simulation results, only registered when the simulation runs for this source
+        SimulationSource m_simulationSource;
+        DirectSimulationSettings m_directSettings;
+        bool m_directSimulationEnabled = false;
+        bool m_reflectionsEnabled = false;
+        //! Reflections are simulated and rendered for this node, the effect and its buffers still come and go
+        bool m_reflectionsAvailable = false;
+        //! Ambisonic order of the effect, taken from the reflection settings when it is created
+        int m_reflectionOrder = 0;
+        //! IR length of the effect, taken from the reflection settings when it is created
+        int m_reflectionIrSize = 0;
+        AZStd::atomic<ReflectionState> m_reflectionState{ ReflectionState::Released };
+        //Render thread, samples since reflections were last convolved and how many make the effect Idle
+        int m_reflectionIdleSamples = 0;
+        int m_reflectionIdleLimit = 0;
+        //Game thread
+        AZ::u64 m_reflectionStateBytes = 0;
+        bool m_reflectionCreateFailed = false;
+        //Created and freed with the effect
+        IPLAudioBuffer m_monoBuffer = {};
+        IPLAudioBuffer m_reflectionBuffer = {};
+        IPLAudioBuffer m_reflectionOutBuffer = {};
 
-        int m_lastInputChannelCount = 0;
+        //Render thread, channel count of the layout in use, 0 before the first quantum
+        int m_directChannels = 0;
 
+        //Set by the game thread once the Steam Audio side exists, process() pans plainly until then
+        AZStd::atomic_bool m_spatializerReady{ false };
+        //Set by recycle(), process() resets the render state before its next quantum
+        AZStd::atomic_bool m_resetPending{ false };
+        //Render thread, the plain pan process() uses until then
+        UnspatializedPanner m_unspatializedPanner;
+
+        //Render thread, quanta re-cut into Steam Audio frames and back
+        FrameReblocker m_reblocker;
+        IPLAudioBuffer m_frameInput = {};
+        IPLAudioBuffer m_frameOutput = {};
+        //Whether this quantum already sent a frame to the shared reflection mixer
+        bool m_sharedReflectionsMixed = false;
+
+        //Render thread, built from m_renderParameters
         IPLDistanceAttenuationModel m_distanceModel = {
             IPL_DISTANCEATTENUATIONTYPE_INVERSEDISTANCE,
             1.0f, // minDistance
@@ -108,6 +321,7 @@ namespace TuSteamAudio
         , public Sune::PlayerEffectSpatializationRequestBus::Handler
         , public Sune::PlayerEffectImGuiRequestBus::Handler
         , public SteamAudioEffectRequestBus::Handler
+        , public TuSteamAudioNotificationBus::Handler
     {
     public:
         constexpr static AZ::Crc32 RegisterName = AZ_CRC_CE("SteamAudioHrtf");
@@ -136,7 +350,16 @@ namespace TuSteamAudio
 
         void DrawGui() override;
 
+        // TuSteamAudioNotificationBus
+        void OnReadinessChanged(SystemReadiness readiness) override;
+
     private:
+        //! Pulled by the reflection mixer so the node has contributed before the mixer renders the quantum.
+        void ConnectReflectionMixer();
+
         std::shared_ptr<SteamAudioHrtfNode> m_node = {};
+        std::shared_ptr<SteamAudioReflectionMixerNode> m_reflectionMixerNode;
+        //Game thread copy for the ImGui curve preview
+        Attenuation::AttenuationTable m_previewTable;
     };
 } // TuSteamAudio
\ No newline at end of file
@@ -0,0 +1,171 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SteamAudioReflectionMixer.h"
+#include "ListenerCache.h"
+#include "QualityController.h"
+
+#include <LabSound/core/AudioNodeInput.h>
+#include <LabSound/core/AudioNodeOutput.h>
+#include <LabSound/core/AudioBus.h>
+#include <LabSound/core/AudioContext.h>
+#include <TuSteamAudio/TuSteamAudioBus.h>
+#include <TuSteamAudio/Utils.h>
+#include <TuSteamAudio/Allocators.h>
+#include <Sune/Utils.h>
+
+#include <AzCore/Debug/Profiler.h>
+
+using namespace TuSteamAudio;
+
+lab::AudioNodeDescriptor* SteamAudioReflectionMixerNode::desc()
+{
+    static lab::AudioNodeDescriptor d = {nullptr, nullptr, 2};
+    return &d;
+}
+
+SteamAudioReflectionMixerNode::SteamAudioReflectionMixerNode(lab::AudioContext& ac, int order, int irSize)
+    : AudioNode(ac, *desc())
+    , m_order(order)
+    , m_irSize(irSize)
+{
+    addInput(std::unique_ptr<lab::AudioNodeInput>(new lab::AudioNodeInput(this)));
+
+    initialize();
+}
+
+SteamAudioReflectionMixerNode::~SteamAudioReflectionMixerNode()
+{
+    uninitialize();
+}
+
+void SteamAudioReflectionMixerNode::initialize()
+{
+    if (isInitialized())
+        return;
+
+    m_context = iplContextRetain(TuSteamAudioInterface::Get()->GetContext());
+    IPLAudioSettings audioSettings = TuSteamAudioInterface::Get()->GetAudioSettings();
+
+    IPLReflectionEffectSettings mixerSettings{};
+    mixerSettings.type = IPL_REFLECTIONEFFECTTYPE_CONVOLUTION;
+    mixerSettings.irSize = m_irSize;
+    mixerSettings.numChannels = AmbisonicsBus::GetNumChannels(m_order);
+
+    IPLerror err = iplReflectionMixerCreate(m_context, &audioSettings, &mixerSettings, &m_mixer);
+    if (err != IPL_STATUS_SUCCESS)
+    {
+        AZ_Error("SteamAudioReflectionMixer", false, "Failed to create reflection mixer");
+        m_mixer = nullptr;
+    }
+    else if (!m_bus.Create(m_context, audioSettings, TuSteamAudioInterface::Get()->GetHrtf(), m_order))
+    {
+        iplReflectionMixerRelease(&m_mixer);
+        m_mixer = nullptr;
+    }
+    else
+    {
+        TuSteamAudioInterface::Get()->RegisterHrtfClient(&m_bus);
+    }
+
+    const int maxQuantum = AZStd::max(Sune::SuneInterface::Get()->GetPeriodSizeInFrames(), static_cast<int>(audioSettings.frameSize));
+    m_reblocker.Allocate(0, 2, audioSettings.frameSize, maxQuantum);
+    iplAudioBufferAllocate(m_context, 2, audioSettings.frameSize, &m_frameOutput);
+
+    AudioNode::initialize();
+}
+
+void SteamAudioReflectionMixerNode::uninitialize()
+{
+    if (!isInitialized())
+        return;
+
+    TuSteamAudioInterface::Get()->UnregisterHrtfClient(&m_bus);
+    m_bus.Release();
+    iplAudioBufferFree(m_context, &m_frameOutput);
+    m_frameOutput = {};
+
+    if (m_mixer)
+    {
+        iplReflectionMixerRelease(&m_mixer);
+        m_mixer = nullptr;
+    }
+
+    iplContextRelease(&m_context);
+
+    AudioNode::uninitialize();
+}
+
+void SteamAudioReflectionMixerNode::process(lab::ContextRenderLock& r, int bufferSize)
+{
+    AZ_PROFILE_FUNCTION(Audio);
+
+    lab::AudioBus* outputBus = output(0)->bus(r);
+    if (outputBus == nullptr)
+        return;
+
+    if (!isInitialized() || !m_mixer || !m_reblocker.Begin(r.context()->currentSampleFrame(), bufferSize))
+    {
+        outputBus->zero();
+        return;
+    }
+
+    QualityController::RenderTimer renderTimer(TuSteamAudioInterface::Get()->GetQualityController(), r);
+    RealtimeScope realtime;
+    const IPLCoordinateSpace3& listenerCoords = TuSteamAudioInterface::Get()->GetListenerCache()->Capture(r).m_coords;
+
+    float* outputChannels[2] = { outputBus->channel(0)->mutableData(), outputBus->channel(1)->mutableData() };
+    if (m_reblocker.IsPassthrough())
+    {
+        RenderFrame(listenerCoords, outputChannels, bufferSize);
+        return;
+    }
+
+    // Contributors render on the same frame grid, so whatever frame ends in this quantum has been mixed in
+    const int frameSize = m_reblocker.GetFrameSize();
+    for (int frame = 0; frame < m_reblocker.GetFrameCount(); ++frame)
+    {
+        RenderFrame(listenerCoords, m_frameOutput.data, frameSize);
+        m_reblocker.GetOutput().Write(m_frameOutput.data, 2, frameSize);
+    }
+    m_reblocker.GetOutput().Read(outputChannels, bufferSize);
+}
+
+void SteamAudioReflectionMixerNode::RenderFrame(const IPLCoordinateSpace3& listener, float* const* outputChannels, int frameSize)
+{
+    // Contributors were pulled through our input, so everything for this frame has been mixed in.
+    // Apply also clears the mixer for the next frame.
+    IPLReflectionEffectParams params{};
+    params.type = IPL_REFLECTIONEFFECTTYPE_CONVOLUTION;
+    params.numChannels = m_bus.GetNumChannels();
+    params.irSize = m_irSize;
+    iplReflectionMixerApply(m_mixer, &params, &m_bus.GetBuffer());
+
+    IPLAudioBuffer outBuffer{};
+    outBuffer.numChannels = 2;
+    outBuffer.numSamples = frameSize;
+    outBuffer.data = const_cast<float**>(outputChannels);
+    m_bus.Decode(listener, outBuffer);
+}
+
+void SteamAudioReflectionMixerNode::reset(lab::ContextRenderLock&)
+{
+    if (m_mixer)
+    {
+        iplReflectionMixerReset(m_mixer);
+    }
+    m_reblocker.Reset();
+}
+
+double SteamAudioReflectionMixerNode::tailTime(lab::ContextRenderLock& r) const
+{
+    return static_cast<double>(m_irSize) / r.context()->sampleRate();
+}
+
+double SteamAudioReflectionMixerNode::latencyTime(lab::ContextRenderLock& r) const
+{
+    return static_cast<double>(m_reblocker.GetLatency()) / r.context()->sampleRate();
+}
@@ -0,0 +1,61 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "Sune/PlayerAudioEffect.h"
+#include "AmbisonicsBus.h"
+#include "ReblockingFifo.h"
+#include "phonon.h"
+
+namespace TuSteamAudio
+{
+    //! Listener side of the shared reflection path.
+    //! Every contributing SteamAudioHrtfNode applies its reflection effect into the same IPLReflectionMixer,
+    //! this node then runs the final convolution and binaural decode once per Steam Audio frame.
+    //! Contributors connect their output to this node's input so the graph processes them first,
+    //! the input audio itself is discarded.
+    class SteamAudioReflectionMixerNode : public lab::AudioNode
+    {
+    public:
+        SteamAudioReflectionMixerNode(lab::AudioContext& ac, int order, int irSize);
+        virtual ~SteamAudioReflectionMixerNode();
+
+        static const char* static_name() { return "SteamAudioReflectionMixer"; }
+        const char* name() const override { return static_name(); }
+        static lab::AudioNodeDescriptor* desc();
+
+        void initialize() override;
+        void uninitialize() override;
+
+        void process(lab::ContextRenderLock&, int bufferSize) override;
+        void reset(lab::ContextRenderLock&) override;
+
+        //! Null if the mixer could not be created, contributors then fall back to their own decode.
+        IPLReflectionMixer GetMixer() const { return m_mixer; }
+
+    protected:
+        double tailTime(lab::ContextRenderLock& r) const override;
+        double latencyTime(lab::ContextRenderLock& r) const override;
+        // The reverb tail keeps ringing after every contributor went silent.
+        bool propagatesSilence(lab::ContextRenderLock& r) const override { return false; }
+
+    private:
+        //! Applies the mixer and decodes one Steam Audio frame into outputChannels.
+        void RenderFrame(const IPLCoordinateSpace3& listener, float* const* outputChannels, int frameSize);
+
+        IPLContext m_context = nullptr;
+        IPLReflectionMixer m_mixer = nullptr;
+        AmbisonicsBus m_bus;
+
+        int m_order = 1;
+        int m_irSize = 0;
+
+        //Render thread, frames rendered off the quantum grid wait here until LabSound asks for them
+        FrameReblocker m_reblocker;
+        IPLAudioBuffer m_frameOutput = {};
+    };
+} // TuSteamAudio
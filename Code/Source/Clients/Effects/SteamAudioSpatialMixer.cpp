@@ -0,0 +1,780 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SteamAudioSpatialMixer.h"
+#include "SteamAudioSpatialSource.h"
+#include "AmbisonicsBus.h"
+#include "ListenerCache.h"
+#include "QualityController.h"
+#include "UnspatializedPanner.h"
+
+#include <LabSound/core/AudioNodeOutput.h>
+#include <LabSound/core/AudioBus.h>
+#include <LabSound/core/AudioContext.h>
+#include <TuSteamAudio/TuSteamAudioBus.h>
+#include <TuSteamAudio/Utils.h>
+#include <TuSteamAudio/Allocators.h>
+#include <Sune/Utils.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/MathUtils.h>
+#include <cmath>
+
+using namespace TuSteamAudio;
+
+lab::AudioNodeDescriptor* SteamAudioSpatialMixerNode::desc()
+{
+    static lab::AudioNodeDescriptor d = {nullptr, nullptr, 2};
+    return &d;
+}
+
+SteamAudioSpatialMixerNode::SteamAudioSpatialMixerNode(lab::AudioContext& ac)
+    : AudioNode(ac, *desc())
+{
+    for (auto& state : m_state)
+    {
+        state.store(SlotState::Free, AZStd::memory_order_relaxed);
+    }
+
+    // Sized once up front, the render thread indexes these without synchronization
+    m_taps.resize(MaxSources);
+    m_gameParameters.resize(MaxSources);
+    m_positionX.resize(MaxSources, 0.0f);
+    m_positionY.resize(MaxSources, 0.0f);
+    m_positionZ.resize(MaxSources, 0.0f);
+    m_spatialBlend.resize(MaxSources, 1.0f);
+    m_interpolation.resize(MaxSources, IPL_HRTFINTERPOLATION_BILINEAR);
+    m_distanceModel.resize(MaxSources, IPLDistanceAttenuationModel{ IPL_DISTANCEATTENUATIONTYPE_DEFAULT, 1.0f, nullptr, nullptr, IPL_FALSE });
+    m_minDistance.resize(MaxSources, 1.0f);
+    m_attenuation.resize(MaxSources);
+    m_directEffect.resize(MaxSources, nullptr);
+    m_binauralEffect.resize(MaxSources, nullptr);
+    m_slotHrtf.resize(MaxSources, nullptr);
+    m_nextHrtf.resize(MaxSources, nullptr);
+    m_nextBinauralEffect.resize(MaxSources, nullptr);
+    m_fadeHrtf.resize(MaxSources, nullptr);
+    m_fadeBinauralEffect.resize(MaxSources, nullptr);
+    m_encodeEffect.resize(MaxSources, nullptr);
+    m_paths.Resize(MaxSources);
+
+    initialize();
+}
+
+SteamAudioSpatialMixerNode::~SteamAudioSpatialMixerNode()
+{
+    uninitialize();
+}
+
+void SteamAudioSpatialMixerNode::initialize()
+{
+    if (isInitialized())
+        return;
+
+    m_context = iplContextRetain(TuSteamAudioInterface::Get()->GetContext());
+    m_hrtf = iplHRTFRetain(TuSteamAudioInterface::Get()->GetHrtf());
+    m_audioSettings = TuSteamAudioInterface::Get()->GetAudioSettings();
+    m_listenerCache = TuSteamAudioInterface::Get()->GetListenerCache();
+    m_qualityController = TuSteamAudioInterface::Get()->GetQualityController();
+
+    iplAudioBufferAllocate(m_context, 1, m_audioSettings.frameSize, &m_directBuffer);
+    iplAudioBufferAllocate(m_context, 2, m_audioSettings.frameSize, &m_binauralBuffer);
+    iplAudioBufferAllocate(m_context, 2, m_audioSettings.frameSize, &m_frameOutput);
+    iplAudioBufferAllocate(m_context, 2, m_audioSettings.frameSize, &m_hrtfFadeBuffer);
+
+    const int maxQuantum = AZStd::max(Sune::SuneInterface::Get()->GetPeriodSizeInFrames(), static_cast<int>(m_audioSettings.frameSize));
+    m_reblocker.Allocate(0, 2, m_audioSettings.frameSize, maxQuantum);
+
+    m_ambisonicsBus = TuSteamAudioInterface::Get()->GetAmbisonicsBus();
+    if (m_ambisonicsBus)
+    {
+        iplAudioBufferAllocate(m_context, m_ambisonicsBus->GetNumChannels(), m_audioSettings.frameSize, &m_encodedBuffer);
+    }
+
+    TuSteamAudioInterface::Get()->RegisterHrtfClient(this);
+
+    AudioNode::initialize();
+}
+
+void SteamAudioSpatialMixerNode::uninitialize()
+{
+    if (!isInitialized())
+        return;
+
+    TuSteamAudioInterface::Get()->UnregisterHrtfClient(this);
+
+    const AZ::u32 highWater = m_slotHighWater.load(AZStd::memory_order_acquire);
+    for (AZ::u32 i = 0; i < highWater; ++i)
+    {
+        if (m_state[i].load(AZStd::memory_order_acquire) != SlotState::Free)
+        {
+            ReleaseSlot(i);
+        }
+    }
+    m_slotHighWater.store(0, AZStd::memory_order_release);
+    m_hrtfSwapState.store(HrtfSwapState::Idle, AZStd::memory_order_relaxed);
+
+    iplAudioBufferFree(m_context, &m_directBuffer);
+    iplAudioBufferFree(m_context, &m_binauralBuffer);
+    iplAudioBufferFree(m_context, &m_frameOutput);
+    iplAudioBufferFree(m_context, &m_hrtfFadeBuffer);
+    if (m_encodedBuffer.numChannels > 0)
+    {
+        iplAudioBufferFree(m_context, &m_encodedBuffer);
+        m_encodedBuffer = {};
+    }
+    m_ambisonicsBus = nullptr;
+    m_qualityController = nullptr;
+
+    iplHRTFRelease(&m_hrtf);
+    iplContextRelease(&m_context);
+
+    AudioNode::uninitialize();
+}
+
+void SteamAudioSpatialMixerNode::process(lab::ContextRenderLock& r, int bufferSize)
+{
+    AZ_PROFILE_FUNCTION(Audio);
+
+    lab::AudioBus* outputBus = output(0)->bus(r);
+    if (outputBus == nullptr)
+        return;
+
+    outputBus->zero();
+
+    if (!isInitialized())
+    {
+        return;
+    }
+
+    if (!m_reblocker.Begin(r.context()->currentSampleFrame(), bufferSize))
+    {
+        AZ_ErrorOnce("SteamAudioSpatialMixer", false, "Quantum of %d samples is larger than the mixer was prepared for", bufferSize);
+        return;
+    }
+
+    // Before any slot is retired below, so the game thread never releases a slot the swap is touching
+    BeginHrtfSwap();
+
+    // Listener is read once for every source
+    const IPLCoordinateSpace3& listener = m_listenerCache->Capture(r).m_coords;
+
+    float* outputChannels[2] = { outputBus->channel(0)->mutableData(), outputBus->channel(1)->mutableData() };
+
+    const AZ::u32 highWater = m_slotHighWater.load(AZStd::memory_order_acquire);
+
+    // Once per quantum, whatever the game thread published last
+    ReceiveParameters(highWater);
+
+    // Player graphs first, so the quality controller only measures the spatialization below
+    for (AZ::u32 i = 0; i < highWater; ++i)
+    {
+        if (m_state[i].load(AZStd::memory_order_acquire) == SlotState::Active)
+        {
+            m_taps[i]->processIfNecessary(r, bufferSize);
+        }
+    }
+    QualityController::RenderTimer renderTimer(m_qualityController, r);
+    RealtimeScope realtime;
+
+    // Direct path parameters for every slot in one pass, free slots are computed too since
+    // skipping them would cost more than the math
+    DirectPathSources sources;
+    sources.m_positionX = m_positionX.data();
+    sources.m_positionY = m_positionY.data();
+    sources.m_positionZ = m_positionZ.data();
+    sources.m_minDistance = m_minDistance.data();
+    sources.m_count = highWater;
+    const float* airAbsorptionCoefficients = m_airAbsModel.type == IPL_AIRABSORPTIONTYPE_EXPONENTIAL ?
+        m_airAbsModel.coefficients : DefaultAirAbsorptionCoefficients;
+    CalculateDirectPaths(listener, sources, airAbsorptionCoefficients, m_paths);
+
+    // Released slots are handed back whether or not a frame is rendered this quantum
+    for (AZ::u32 i = 0; i < highWater; ++i)
+    {
+        if (m_state[i].load(AZStd::memory_order_acquire) == SlotState::Releasing)
+        {
+            m_state[i].store(SlotState::Retired, AZStd::memory_order_release);
+        }
+    }
+
+    // Steam Audio runs on its own frame grid unless it lines up with the quantum, every tap queued its quantum on the same one
+    const bool passthrough = m_reblocker.IsPassthrough();
+    const int frameSize = m_reblocker.GetFrameSize();
+    const int frameCount = passthrough ? 1 : m_reblocker.GetFrameCount();
+    for (int frame = 0; frame < frameCount; ++frame)
+    {
+        for (AZ::u32 i = 0; i < highWater; ++i)
+        {
+            if (m_state[i].load(AZStd::memory_order_acquire) == SlotState::Active)
+            {
+                // Only pulls a source added since the pass above
+                m_taps[i]->processIfNecessary(r, bufferSize);
+                m_taps[i]->ReadFrame();
+            }
+        }
+
+        if (passthrough)
+        {
+            MixFrame(listener, highWater, outputChannels, frameSize);
+            AdvanceHrtfSwap(frameSize);
+            return;
+        }
+
+        for (int channel = 0; channel < 2; ++channel)
+        {
+            AZStd::fill(m_frameOutput.data[channel], m_frameOutput.data[channel] + frameSize, 0.0f);
+        }
+        MixFrame(listener, highWater, m_frameOutput.data, frameSize);
+        AdvanceHrtfSwap(frameSize);
+        m_reblocker.GetOutput().Write(m_frameOutput.data, 2, frameSize);
+    }
+    m_reblocker.GetOutput().Read(outputChannels, bufferSize);
+}
+
+void SteamAudioSpatialMixerNode::MixFrame(const IPLCoordinateSpace3& listener, AZ::u32 highWater,
+    float* const* outputChannels, int frameSize)
+{
+    const IPLVector3 listenerIPL = listener.origin;
+    const SpatialQuality quality = m_qualityController ? m_qualityController->GetQuality() : SpatialQuality::Bilinear;
+
+    const bool ambisonics = m_ambisonicsBus &&
+        TuSteamAudioInterface::Get()->GetSpatialRenderMode() == SpatialRenderMode::Ambisonics;
+    if (ambisonics)
+    {
+        m_ambisonicsBus->Clear();
+    }
+
+    for (AZ::u32 i = 0; i < highWater; ++i)
+    {
+        if (m_state[i].load(AZStd::memory_order_acquire) != SlotState::Active)
+        {
+            continue;
+        }
+
+        float* inputChannels[1] = { const_cast<float*>(m_taps[i]->GetSamples()) };
+        IPLAudioBuffer inBuffer{};
+        inBuffer.numChannels = 1;
+        inBuffer.numSamples = frameSize;
+        inBuffer.data = inputChannels;
+
+        const float distanceAttenuation = m_distanceModel[i].type == IPL_DISTANCEATTENUATIONTYPE_CALLBACK ?
+            m_attenuation[i].Lookup(m_paths.m_distance[i]) : m_paths.m_distanceAttenuation[i];
+
+        // Same blend as SteamAudioHrtfNode
+        const float spatialBlend = m_spatialBlend[i];
+        const float _distanceAttenuation = (1.0f - spatialBlend) + spatialBlend * distanceAttenuation;
+        const float _spatialBlend = (spatialBlend == 1.0f && distanceAttenuation == 0.0f) ? 1.0f :
+                                    spatialBlend * distanceAttenuation / _distanceAttenuation;
+
+        IPLDirectEffectParams directParams{};
+        directParams.flags = static_cast<IPLDirectEffectFlags>(IPL_DIRECTEFFECTFLAGS_APPLYDISTANCEATTENUATION |
+            IPL_DIRECTEFFECTFLAGS_APPLYAIRABSORPTION);
+        directParams.distanceAttenuation = _distanceAttenuation;
+        directParams.airAbsorption[0] = m_paths.m_airAbsorption[0][i];
+        directParams.airAbsorption[1] = m_paths.m_airAbsorption[1][i];
+        directParams.airAbsorption[2] = m_paths.m_airAbsorption[2][i];
+
+        iplDirectEffectApply(m_directEffect[i], &directParams, &inBuffer, &m_directBuffer);
+
+        if (ambisonics && m_encodeEffect[i])
+        {
+            // The decoder rotates into listener space, so the encode direction stays in world space
+            const IPLVector3 worldDirection = { m_positionX[i] - listenerIPL.x, m_positionY[i] - listenerIPL.y, m_positionZ[i] - listenerIPL.z };
+            EncodeAmbisonics(i, worldDirection, _spatialBlend, outputChannels, frameSize);
+        }
+        else
+        {
+            const IPLVector3 direction = { m_paths.m_directionX[i], m_paths.m_directionY[i], m_paths.m_directionZ[i] };
+            if (quality == SpatialQuality::Panning || quality == SpatialQuality::StereoPan)
+            {
+                MixStereoPan(direction, _spatialBlend, outputChannels, frameSize);
+            }
+            else
+            {
+                const IPLHRTFInterpolation interpolation = quality == SpatialQuality::Nearest ? IPL_HRTFINTERPOLATION_NEAREST : m_interpolation[i];
+                MixBinaural(i, direction, interpolation, _spatialBlend, outputChannels, frameSize);
+            }
+        }
+    }
+
+    if (ambisonics)
+    {
+        // One HRTF pass for every source in the bus
+        m_ambisonicsBus->Decode(listener, m_binauralBuffer);
+        for (int channel = 0; channel < 2; ++channel)
+        {
+            const float* src = m_binauralBuffer.data[channel];
+            float* dst = outputChannels[channel];
+            for (int sample = 0; sample < frameSize; ++sample)
+            {
+                dst[sample] += src[sample];
+            }
+        }
+    }
+}
+
+void SteamAudioSpatialMixerNode::MixBinaural(AZ::u32 index, const IPLVector3& direction, IPLHRTFInterpolation interpolation,
+    float spatialBlend, float* const* outputChannels, int bufferSize)
+{
+    IPLBinauralEffectParams params{};
+    params.direction = direction;
+    params.interpolation = interpolation;
+    params.spatialBlend = spatialBlend;
+    params.hrtf = m_slotHrtf[index];
+    params.peakDelays = nullptr;
+    iplBinauralEffectApply(m_binauralEffect[index], &params, &m_directBuffer, &m_binauralBuffer);
+
+    // Sources added since the swap started have nothing to fade from
+    if (m_fadeBinauralEffect[index] && m_hrtfSwapState.load(AZStd::memory_order_relaxed) == HrtfSwapState::Fading)
+    {
+        params.hrtf = m_fadeHrtf[index];
+        iplBinauralEffectApply(m_fadeBinauralEffect[index], &params, &m_directBuffer, &m_hrtfFadeBuffer);
+        m_hrtfFade.Apply(m_hrtfFadeBuffer, m_binauralBuffer);
+    }
+
+    for (int channel = 0; channel < 2; ++channel)
+    {
+        const float* src = m_binauralBuffer.data[channel];
+        float* dst = outputChannels[channel];
+        for (int frame = 0; frame < bufferSize; ++frame)
+        {
+            dst[frame] += src[frame];
+        }
+    }
+}
+
+void SteamAudioSpatialMixerNode::MixStereoPan(const IPLVector3& direction, float spatialBlend,
+    float* const* outputChannels, int bufferSize)
+{
+    // The dry share goes to both ears like the binaural blend
+    float gains[2];
+    ConstantPowerPan(direction.x, gains);
+    const float dryGain = 1.0f - spatialBlend;
+    gains[0] = gains[0] * spatialBlend + dryGain;
+    gains[1] = gains[1] * spatialBlend + dryGain;
+
+    const float* direct = m_directBuffer.data[0];
+    for (int channel = 0; channel < 2; ++channel)
+    {
+        float* dst = outputChannels[channel];
+        for (int frame = 0; frame < bufferSize; ++frame)
+        {
+            dst[frame] += direct[frame] * gains[channel];
+        }
+    }
+}
+
+void SteamAudioSpatialMixerNode::EncodeAmbisonics(AZ::u32 index, const IPLVector3& worldDirection, float spatialBlend,
+    float* const* outputChannels, int bufferSize)
+{
+    const float* direct = m_directBuffer.data[0];
+
+    // Encoding has no spatial blend, the dry share goes straight to both ears
+    if (spatialBlend < 1.0f)
+    {
+        const float dryGain = 1.0f - spatialBlend;
+        for (int channel = 0; channel < 2; ++channel)
+        {
+            float* dst = outputChannels[channel];
+            for (int frame = 0; frame < bufferSize; ++frame)
+            {
+                dst[frame] += direct[frame] * dryGain;
+            }
+        }
+
+        float* wet = m_directBuffer.data[0];
+        for (int frame = 0; frame < bufferSize; ++frame)
+        {
+            wet[frame] *= spatialBlend;
+        }
+    }
+
+    IPLAmbisonicsEncodeEffectParams params{};
+    params.direction = worldDirection;
+    params.order = m_ambisonicsBus->GetOrder();
+    iplAmbisonicsEncodeEffectApply(m_encodeEffect[index], &params, &m_directBuffer, &m_encodedBuffer);
+
+    m_ambisonicsBus->Accumulate(m_encodedBuffer);
+}
+
+void SteamAudioSpatialMixerNode::reset(lab::ContextRenderLock&)
+{
+    m_reblocker.Reset();
+
+    const AZ::u32 highWater = m_slotHighWater.load(AZStd::memory_order_acquire);
+    for (AZ::u32 i = 0; i < highWater; ++i)
+    {
+        if (m_state[i].load(AZStd::memory_order_acquire) == SlotState::Active)
+        {
+            iplBinauralEffectReset(m_binauralEffect[i]);
+            iplDirectEffectReset(m_directEffect[i]);
+            if (m_encodeEffect[i])
+            {
+                iplAmbisonicsEncodeEffectReset(m_encodeEffect[i]);
+            }
+        }
+    }
+}
+
+SpatialSourceId SteamAudioSpatialMixerNode::AddSource(std::shared_ptr<SteamAudioSourceTapNode> tap)
+{
+    if (!isInitialized() || !tap)
+    {
+        return InvalidSpatialSourceId;
+    }
+
+    AZ::u32 index = 0;
+    for (; index < MaxSources; ++index)
+    {
+        if (m_state[index].load(AZStd::memory_order_acquire) == SlotState::Free)
+        {
+            break;
+        }
+    }
+
+    if (index == MaxSources)
+    {
+        AZ_Error("SteamAudioSpatialMixer", false, "Out of spatial source slots (%u)", MaxSources);
+        return InvalidSpatialSourceId;
+    }
+
+    IPLBinauralEffectSettings binauralSettings{};
+    binauralSettings.hrtf = m_hrtf;
+    IPLerror err = iplBinauralEffectCreate(m_context, &m_audioSettings, &binauralSettings, &m_binauralEffect[index]);
+    if (err != IPL_STATUS_SUCCESS)
+    {
+        AZ_Error("SteamAudioSpatialMixer", false, "Failed to create binaural effect");
+        m_binauralEffect[index] = nullptr;
+        return InvalidSpatialSourceId;
+    }
+
+    // Taps downmix to mono, so every direct effect has the same layout
+    IPLDirectEffectSettings directSettings{};
+    directSettings.numChannels = 1;
+    err = iplDirectEffectCreate(m_context, &m_audioSettings, &directSettings, &m_directEffect[index]);
+    if (err != IPL_STATUS_SUCCESS)
+    {
+        AZ_Error("SteamAudioSpatialMixer", false, "Failed to create direct effect");
+        iplBinauralEffectRelease(&m_binauralEffect[index]);
+        m_binauralEffect[index] = nullptr;
+        m_directEffect[index] = nullptr;
+        return InvalidSpatialSourceId;
+    }
+    m_slotHrtf[index] = iplHRTFRetain(m_hrtf);
+
+    if (m_ambisonicsBus)
+    {
+        IPLAmbisonicsEncodeEffectSettings encodeSettings{};
+        encodeSettings.maxOrder = m_ambisonicsBus->GetOrder();
+        err = iplAmbisonicsEncodeEffectCreate(m_context, &m_audioSettings, &encodeSettings, &m_encodeEffect[index]);
+        if (err != IPL_STATUS_SUCCESS)
+        {
+            AZ_Warning("SteamAudioSpatialMixer", false, "Failed to create ambisonics encode effect, source stays binaural");
+            m_encodeEffect[index] = nullptr;
+        }
+    }
+
+    // Picked up on the first quantum the slot is active, before anything of it is rendered
+    m_taps[index] = AZStd::move(tap);
+    m_gameParameters[index] = {};
+    PublishParameters(static_cast<SpatialSourceId>(index));
+
+    if (index >= m_slotHighWater.load(AZStd::memory_order_relaxed))
+    {
+        m_slotHighWater.store(index + 1, AZStd::memory_order_release);
+    }
+
+    m_activeSourceCount.fetch_add(1, AZStd::memory_order_relaxed);
+    m_state[index].store(SlotState::Active, AZStd::memory_order_release);
+
+    return static_cast<SpatialSourceId>(index);
+}
+
+void SteamAudioSpatialMixerNode::RemoveSource(SpatialSourceId id)
+{
+    if (!IsValidSource(id))
+    {
+        return;
+    }
+
+    m_activeSourceCount.fetch_sub(1, AZStd::memory_order_relaxed);
+    m_state[id].store(SlotState::Releasing, AZStd::memory_order_release);
+}
+
+void SteamAudioSpatialMixerNode::CollectRetiredSources()
+{
+    const AZ::u32 highWater = m_slotHighWater.load(AZStd::memory_order_acquire);
+    for (AZ::u32 i = 0; i < highWater; ++i)
+    {
+        if (m_state[i].load(AZStd::memory_order_acquire) == SlotState::Retired)
+        {
+            ReleaseSlot(i);
+        }
+    }
+}
+
+void SteamAudioSpatialMixerNode::ReleaseSlot(AZ::u32 index)
+{
+    if (m_directEffect[index])
+    {
+        iplDirectEffectRelease(&m_directEffect[index]);
+        m_directEffect[index] = nullptr;
+    }
+
+    ReleaseBinaural(m_slotHrtf[index], m_binauralEffect[index]);
+    ReleaseBinaural(m_nextHrtf[index], m_nextBinauralEffect[index]);
+    ReleaseBinaural(m_fadeHrtf[index], m_fadeBinauralEffect[index]);
+
+    if (m_encodeEffect[index])
+    {
+        iplAmbisonicsEncodeEffectRelease(&m_encodeEffect[index]);
+        m_encodeEffect[index] = nullptr;
+    }
+
+    m_taps[index] = nullptr;
+    m_state[index].store(SlotState::Free, AZStd::memory_order_release);
+}
+
+void SteamAudioSpatialMixerNode::ReleaseBinaural(IPLHRTF& hrtf, IPLBinauralEffect& binauralEffect)
+{
+    if (binauralEffect)
+    {
+        iplBinauralEffectRelease(&binauralEffect);
+        binauralEffect = nullptr;
+    }
+
+    if (hrtf)
+    {
+        iplHRTFRelease(&hrtf);
+        hrtf = nullptr;
+    }
+}
+
+void SteamAudioSpatialMixerNode::BeginHrtfSwap()
+{
+    HrtfSwapState offered = HrtfSwapState::Offered;
+    if (!m_hrtfSwapState.compare_exchange_strong(offered, HrtfSwapState::Fading, AZStd::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    // Only active slots, one being released may be collected by the game thread as soon as it is retired
+    const AZ::u32 highWater = m_slotHighWater.load(AZStd::memory_order_acquire);
+    for (AZ::u32 i = 0; i < highWater; ++i)
+    {
+        if (!m_nextBinauralEffect[i] || m_state[i].load(AZStd::memory_order_acquire) != SlotState::Active)
+        {
+            continue;
+        }
+
+        m_fadeHrtf[i] = m_slotHrtf[i];
+        m_fadeBinauralEffect[i] = m_binauralEffect[i];
+        m_slotHrtf[i] = m_nextHrtf[i];
+        m_binauralEffect[i] = m_nextBinauralEffect[i];
+        m_nextHrtf[i] = nullptr;
+        m_nextBinauralEffect[i] = nullptr;
+    }
+
+    const int frameSize = m_reblocker.GetFrameSize();
+    m_hrtfFade.Start(frameSize, frameSize);
+}
+
+void SteamAudioSpatialMixerNode::AdvanceHrtfSwap(int numSamples)
+{
+    if (m_hrtfSwapState.load(AZStd::memory_order_relaxed) == HrtfSwapState::Fading && m_hrtfFade.Advance(numSamples))
+    {
+        m_hrtfSwapState.store(HrtfSwapState::Retired, AZStd::memory_order_release);
+    }
+}
+
+void SteamAudioSpatialMixerNode::UpdateHrtf(IPLHRTF hrtf)
+{
+    const AZ::u32 highWater = m_slotHighWater.load(AZStd::memory_order_acquire);
+
+    if (m_hrtfSwapState.load(AZStd::memory_order_acquire) == HrtfSwapState::Retired)
+    {
+        for (AZ::u32 i = 0; i < highWater; ++i)
+        {
+            ReleaseBinaural(m_fadeHrtf[i], m_fadeBinauralEffect[i]);
+        }
+        m_hrtfSwapState.store(HrtfSwapState::Idle, AZStd::memory_order_release);
+    }
+
+    if (!isInitialized() || hrtf == m_hrtf)
+    {
+        return;
+    }
+
+    // Not picked up yet, take it back and offer the newer one instead
+    HrtfSwapState offered = HrtfSwapState::Offered;
+    if (m_hrtfSwapState.compare_exchange_strong(offered, HrtfSwapState::Idle, AZStd::memory_order_acq_rel))
+    {
+        for (AZ::u32 i = 0; i < highWater; ++i)
+        {
+            ReleaseBinaural(m_nextHrtf[i], m_nextBinauralEffect[i]);
+        }
+    }
+
+    if (m_hrtfSwapState.load(AZStd::memory_order_acquire) != HrtfSwapState::Idle)
+    {
+        return;
+    }
+
+    // Sources added from here on are bound to the new HRTF directly
+    iplHRTFRelease(&m_hrtf);
+    m_hrtf = iplHRTFRetain(hrtf);
+
+    // A slot whose effect can't be created stays on the HRTF it has
+    for (AZ::u32 i = 0; i < highWater; ++i)
+    {
+        if (m_state[i].load(AZStd::memory_order_acquire) != SlotState::Active || m_slotHrtf[i] == hrtf)
+        {
+            continue;
+        }
+
+        IPLBinauralEffectSettings binauralSettings{};
+        binauralSettings.hrtf = hrtf;
+        if (iplBinauralEffectCreate(m_context, &m_audioSettings, &binauralSettings, &m_nextBinauralEffect[i]) != IPL_STATUS_SUCCESS)
+        {
+            AZ_Error("SteamAudioSpatialMixer", false, "Failed to create binaural effect for the new HRTF");
+            m_nextBinauralEffect[i] = nullptr;
+            continue;
+        }
+        m_nextHrtf[i] = iplHRTFRetain(hrtf);
+    }
+
+    m_hrtfSwapState.store(HrtfSwapState::Offered, AZStd::memory_order_release);
+}
+
+bool SteamAudioSpatialMixerNode::IsValidSource(SpatialSourceId id) const
+{
+    return id >= 0 && static_cast<AZ::u32>(id) < MaxSources &&
+        m_state[id].load(AZStd::memory_order_acquire) == SlotState::Active;
+}
+
+void SteamAudioSpatialMixerNode::PublishParameters(SpatialSourceId id)
+{
+    m_parameters[id].Write(m_gameParameters[id]);
+}
+
+void SteamAudioSpatialMixerNode::ReceiveParameters(AZ::u32 highWater)
+{
+    SpatialSourceParameters parameters;
+    for (AZ::u32 i = 0; i < highWater; ++i)
+    {
+        if (m_state[i].load(AZStd::memory_order_acquire) != SlotState::Active || !m_parameters[i].Read(parameters))
+        {
+            continue;
+        }
+
+        m_positionX[i] = parameters.m_position.x;
+        m_positionY[i] = parameters.m_position.y;
+        m_positionZ[i] = parameters.m_position.z;
+        m_spatialBlend[i] = parameters.m_spatialBlend;
+        m_interpolation[i] = parameters.m_interpolation;
+
+        IPLDistanceAttenuationModel& distanceModel = m_distanceModel[i];
+        distanceModel.type = parameters.m_distanceModelType;
+        distanceModel.minDistance = parameters.m_minDistance;
+        if (distanceModel.type == IPL_DISTANCEATTENUATIONTYPE_CALLBACK)
+        {
+            distanceModel.callback = DistanceAttenuationCallback;
+            distanceModel.userData = &m_attenuation[i];
+        }
+        else
+        {
+            distanceModel.callback = nullptr;
+            distanceModel.userData = nullptr;
+        }
+        distanceModel.dirty = IPL_TRUE;
+
+        // Only recompiles when the curve changed. The table is never rebuilt while MixFrame reads it
+        m_attenuation[i].Build(parameters.m_attenuation);
+
+        // Steam Audio's default model is inverse distance clamped at 1m, whatever minDistance says
+        m_minDistance[i] = distanceModel.type == IPL_DISTANCEATTENUATIONTYPE_INVERSEDISTANCE ? distanceModel.minDistance : 1.0f;
+    }
+}
+
+void SteamAudioSpatialMixerNode::SetSourceTransform(SpatialSourceId id, const AZ::Transform& transform)
+{
+    if (!IsValidSource(id))
+        return;
+
+    auto sourcePos = Sune::ToLab(transform.GetTranslation());
+    m_gameParameters[id].m_position = IPLVector3{ sourcePos.x, sourcePos.y, sourcePos.z };
+    PublishParameters(id);
+}
+
+void SteamAudioSpatialMixerNode::SetSourceSpatialBlend(SpatialSourceId id, float blend)
+{
+    if (!IsValidSource(id))
+        return;
+
+    m_gameParameters[id].m_spatialBlend = blend;
+    PublishParameters(id);
+}
+
+void SteamAudioSpatialMixerNode::SetSourceInterpolation(SpatialSourceId id, IPLHRTFInterpolation interp)
+{
+    if (!IsValidSource(id))
+        return;
+
+    m_gameParameters[id].m_interpolation = interp;
+    PublishParameters(id);
+}
+
+void SteamAudioSpatialMixerNode::SetSourceDistanceModel(SpatialSourceId id, DistanceModel model)
+{
+    if (!IsValidSource(id))
+        return;
+
+    m_gameParameters[id].m_distanceModelType = ToDistanceModelType(model);
+    PublishParameters(id);
+}
+
+void SteamAudioSpatialMixerNode::SetSourceMinDistance(SpatialSourceId id, float minDistance)
+{
+    if (!IsValidSource(id))
+        return;
+
+    m_gameParameters[id].m_minDistance = minDistance;
+    PublishParameters(id);
+}
+
+void SteamAudioSpatialMixerNode::SetSourceAttenuation(SpatialSourceId id, const Attenuation::TuAttenuation& settings)
+{
+    if (!IsValidSource(id))
+        return;
+
+    m_gameParameters[id].m_attenuation = settings;
+    PublishParameters(id);
+}
+
+double SteamAudioSpatialMixerNode::tailTime(lab::ContextRenderLock& r) const
+{
+    IPLint32 tailSamples = 0;
+    const AZ::u32 highWater = m_slotHighWater.load(AZStd::memory_order_acquire);
+    for (AZ::u32 i = 0; i < highWater; ++i)
+    {
+        if (m_state[i].load(AZStd::memory_order_acquire) == SlotState::Active)
+        {
+            tailSamples = AZStd::max(tailSamples, iplBinauralEffectGetTailSize(m_binauralEffect[i]));
+        }
+    }
+
+    return static_cast<double>(tailSamples) / r.context()->sampleRate();
+}
+
+double SteamAudioSpatialMixerNode::latencyTime(lab::ContextRenderLock& r) const
+{
+    return static_cast<double>(m_reblocker.GetLatency()) / r.context()->sampleRate();
+}
+
+float SteamAudioSpatialMixerNode::DistanceAttenuationCallback(IPLfloat32 distance, void* userData)
+{
+    return static_cast<const Attenuation::AttenuationTable*>(userData)->Lookup(distance);
+}
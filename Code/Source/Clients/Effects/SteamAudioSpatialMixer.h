@@ -0,0 +1,205 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "Sune/PlayerAudioEffect.h"
+#include "DirectPathKernel.h"
+#include "ReblockingFifo.h"
+#include "TripleBuffer.h"
+#include "Clients/Hrtf/HrtfSwap.h"
+#include "TuSteamAudio/Types.h"
+#include "TuSteamAudio/AttenuationTable.h"
+#include "phonon.h"
+
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace TuSteamAudio
+{
+    class SteamAudioSourceTapNode;
+    class AmbisonicsBus;
+    class ListenerCache;
+    class QualityController;
+
+    using SpatialSourceId = AZ::s32;
+    constexpr SpatialSourceId InvalidSpatialSourceId = -1;
+
+    //! Everything the game side controls about one batched source, handed to the render thread as one block.
+    struct SpatialSourceParameters
+    {
+        //! LabSound space, same as the listener
+        IPLVector3 m_position = { 0.0f, 0.0f, 0.0f };
+        float m_spatialBlend = 1.0f;
+        IPLHRTFInterpolation m_interpolation = IPL_HRTFINTERPOLATION_BILINEAR;
+        IPLDistanceAttenuationModelType m_distanceModelType = IPL_DISTANCEATTENUATIONTYPE_DEFAULT;
+        float m_minDistance = 1.0f;
+        //! Compiled into the slot's table on the render thread
+        Attenuation::TuAttenuation m_attenuation = {};
+    };
+
+    //! Steam Audio's model for a DistanceModel, TuAttenuation curves go through the distance callback.
+    inline IPLDistanceAttenuationModelType ToDistanceModelType(DistanceModel model)
+    {
+        switch (model)
+        {
+        case DistanceModel::TuAttenuation:
+            return IPL_DISTANCEATTENUATIONTYPE_CALLBACK;
+        case DistanceModel::InverseDistance:
+            return IPL_DISTANCEATTENUATIONTYPE_INVERSEDISTANCE;
+        default:
+            return IPL_DISTANCEATTENUATIONTYPE_DEFAULT;
+        }
+    }
+
+    //! Spatializes every batched source in a single process() call and sums them into one stereo output.
+    //! Sources are stored structure-of-arrays, indexed by SpatialSourceId.
+    //! Slots are added/removed/configured from the game thread. Setters publish the slot's parameters whole,
+    //! process() copies the newest block of every slot into the arrays once per quantum.
+    //! A new HRTF gets every active slot a binaural effect of its own, all slots crossfade to them on the same frame.
+    class SteamAudioSpatialMixerNode
+        : public lab::AudioNode
+        , public HrtfClient
+    {
+    public:
+        static constexpr AZ::u32 MaxSources = 512;
+
+        SteamAudioSpatialMixerNode(lab::AudioContext& ac);
+        virtual ~SteamAudioSpatialMixerNode();
+
+        static const char* static_name() { return "SteamAudioSpatialMixer"; }
+        const char* name() const override { return static_name(); }
+        static lab::AudioNodeDescriptor* desc();
+
+        void initialize() override;
+        void uninitialize() override;
+
+        void process(lab::ContextRenderLock&, int bufferSize) override;
+        void reset(lab::ContextRenderLock&) override;
+
+        // Game thread
+        SpatialSourceId AddSource(std::shared_ptr<SteamAudioSourceTapNode> tap);
+        void RemoveSource(SpatialSourceId id);
+        //! Releases the effects of sources the render thread has finished with.
+        void CollectRetiredSources();
+
+        void SetSourceTransform(SpatialSourceId id, const AZ::Transform& transform);
+        void SetSourceSpatialBlend(SpatialSourceId id, float blend);
+        void SetSourceInterpolation(SpatialSourceId id, IPLHRTFInterpolation interp);
+        void SetSourceDistanceModel(SpatialSourceId id, DistanceModel model);
+        void SetSourceMinDistance(SpatialSourceId id, float minDistance);
+        void SetSourceAttenuation(SpatialSourceId id, const Attenuation::TuAttenuation& settings);
+
+        AZ::u32 GetActiveSourceCount() const { return m_activeSourceCount.load(AZStd::memory_order_relaxed); }
+
+        // HrtfClient
+        void UpdateHrtf(IPLHRTF hrtf) override;
+
+    protected:
+        double tailTime(lab::ContextRenderLock& r) const override;
+        double latencyTime(lab::ContextRenderLock& r) const override;
+        // Has no inputs, so would otherwise be treated as silent and never processed.
+        bool propagatesSilence(lab::ContextRenderLock& r) const override { return false; }
+
+        static float IPLCALL DistanceAttenuationCallback(IPLfloat32 distance, void* userData);
+
+    private:
+        enum class SlotState : AZ::u8
+        {
+            Free,
+            Active,
+            Releasing, // Set by the game thread, the render thread must stop using the slot
+            Retired    // Set by the render thread, the game thread may now release the slot
+        };
+
+        //! Every active source for one Steam Audio frame, summed into outputChannels.
+        void MixFrame(const IPLCoordinateSpace3& listener, AZ::u32 highWater, float* const* outputChannels, int frameSize);
+        void MixBinaural(AZ::u32 index, const IPLVector3& direction, IPLHRTFInterpolation interpolation, float spatialBlend,
+            float* const* outputChannels, int bufferSize);
+        //! Constant power pan of m_directBuffer, what the mixer falls back to below Nearest quality.
+        void MixStereoPan(const IPLVector3& direction, float spatialBlend, float* const* outputChannels, int bufferSize);
+        void EncodeAmbisonics(AZ::u32 index, const IPLVector3& worldDirection, float spatialBlend, float* const* outputChannels, int bufferSize);
+
+        bool IsValidSource(SpatialSourceId id) const;
+        //! Game thread, hands the slot's parameters to the render thread.
+        void PublishParameters(SpatialSourceId id);
+        //! Render thread, takes the newest published parameters of every active slot.
+        void ReceiveParameters(AZ::u32 highWater);
+        void ReleaseSlot(AZ::u32 index);
+
+        //! Render thread, takes every offered binaural effect at once and starts the crossfade to them.
+        void BeginHrtfSwap();
+        void AdvanceHrtfSwap(int numSamples);
+        //! Game thread, releases the effects a slot faded away from or an offer that was withdrawn.
+        static void ReleaseBinaural(IPLHRTF& hrtf, IPLBinauralEffect& binauralEffect);
+
+        //Globals retained
+        IPLContext m_context = nullptr;
+        //! Game thread, the HRTF new sources are bound to
+        IPLHRTF m_hrtf = nullptr;
+        IPLAudioSettings m_audioSettings = {};
+
+        //Per source, structure of arrays
+        AZStd::array<AZStd::atomic<SlotState>, MaxSources> m_state;
+        AZStd::vector<std::shared_ptr<SteamAudioSourceTapNode>> m_taps;
+        //Settings, the game thread's copy and the hand over. The arrays below are the render thread's
+        AZStd::vector<SpatialSourceParameters> m_gameParameters;
+        AZStd::array<TripleBuffer<SpatialSourceParameters>, MaxSources> m_parameters;
+        AZStd::vector<float> m_positionX;
+        AZStd::vector<float> m_positionY;
+        AZStd::vector<float> m_positionZ;
+        AZStd::vector<float> m_spatialBlend;
+        AZStd::vector<IPLHRTFInterpolation> m_interpolation;
+        AZStd::vector<IPLDistanceAttenuationModel> m_distanceModel;
+        //! Inverse distance clamp handed to the batch kernel, 1 unless the source uses InverseDistance
+        AZStd::vector<float> m_minDistance;
+        AZStd::vector<Attenuation::AttenuationTable> m_attenuation;
+        AZStd::vector<IPLDirectEffect> m_directEffect;
+        AZStd::vector<IPLBinauralEffect> m_binauralEffect;
+        //! The HRTF each binaural effect was created with, retained per slot
+        AZStd::vector<IPLHRTF> m_slotHrtf;
+        AZStd::vector<IPLAmbisonicsEncodeEffect> m_encodeEffect;
+
+        //HRTF swap, next is written by the game thread while Idle, fade released by it once Retired
+        AZStd::atomic<HrtfSwapState> m_hrtfSwapState{ HrtfSwapState::Idle };
+        AZStd::vector<IPLHRTF> m_nextHrtf;
+        AZStd::vector<IPLBinauralEffect> m_nextBinauralEffect;
+        AZStd::vector<IPLHRTF> m_fadeHrtf;
+        AZStd::vector<IPLBinauralEffect> m_fadeBinauralEffect;
+        //Render thread, what a slot's old binaural effect renders while it fades out
+        IPLAudioBuffer m_hrtfFadeBuffer = {};
+        HrtfCrossfade m_hrtfFade;
+
+        //One past the highest slot ever used, bounds the render loop
+        AZStd::atomic<AZ::u32> m_slotHighWater{ 0 };
+        AZStd::atomic<AZ::u32> m_activeSourceCount{ 0 };
+
+        //Scratch, shared by all sources
+        DirectPathResults m_paths;
+        IPLAudioBuffer m_directBuffer = {};
+        IPLAudioBuffer m_binauralBuffer = {};
+        IPLAudioBuffer m_encodedBuffer = {};
+
+        //Render thread, frames rendered off the quantum grid wait here until LabSound asks for them
+        FrameReblocker m_reblocker;
+        IPLAudioBuffer m_frameOutput = {};
+
+        //Owned by the system component, null if ambisonics are unavailable
+        AmbisonicsBus* m_ambisonicsBus = nullptr;
+        ListenerCache* m_listenerCache = nullptr;
+        QualityController* m_qualityController = nullptr;
+
+        IPLAirAbsorptionModel m_airAbsModel = {
+            IPL_AIRABSORPTIONTYPE_DEFAULT,
+            {0.9f, 0.7f, 0.5f},
+            nullptr,
+            nullptr,
+            IPL_FALSE
+        };
+    };
+} // TuSteamAudio
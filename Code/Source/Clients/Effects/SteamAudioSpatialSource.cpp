@@ -0,0 +1,376 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SteamAudioSpatialSource.h"
+#include "ListenerCache.h"
+
+#include <LabSound/core/AudioNodeInput.h>
+#include <LabSound/core/AudioNodeOutput.h>
+#include <LabSound/core/AudioBus.h>
+#include <LabSound/core/AudioContext.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+#include <Sune/Utils.h>
+
+#include "imgui/imgui.h"
+
+using namespace TuSteamAudio;
+
+lab::AudioNodeDescriptor* SteamAudioSourceTapNode::desc()
+{
+    static lab::AudioNodeDescriptor d = {nullptr, nullptr, 2};
+    return &d;
+}
+
+SteamAudioSourceTapNode::SteamAudioSourceTapNode(lab::AudioContext& ac, int frameSize)
+    : AudioNode(ac, *desc())
+{
+    addInput(std::unique_ptr<lab::AudioNodeInput>(new lab::AudioNodeInput(this)));
+    m_samples.resize(frameSize, 0.0f);
+
+    // Same grid and sizes as the mixer, so a frame it renders always finds a whole one here
+    const int maxQuantum = AZStd::max(Sune::SuneInterface::Get()->GetPeriodSizeInFrames(), frameSize);
+    m_reblocker.Allocate(1, 0, frameSize, maxQuantum);
+    m_quantumSamples.resize(maxQuantum, 0.0f);
+
+    // Not Phonon, it is there while the system is still initializing
+    m_listenerCache = TuSteamAudioInterface::Get()->GetListenerCache();
+
+    initialize();
+}
+
+SteamAudioSourceTapNode::~SteamAudioSourceTapNode()
+{
+    uninitialize();
+}
+
+void SteamAudioSourceTapNode::process(lab::ContextRenderLock& r, int bufferSize)
+{
+    AZ_PROFILE_FUNCTION(Audio);
+
+    lab::AudioBus* outputBus = output(0)->bus(r);
+    if (outputBus)
+    {
+        outputBus->zero();
+    }
+
+    if (!m_reblocker.Begin(r.context()->currentSampleFrame(), bufferSize))
+    {
+        AZStd::fill(m_samples.begin(), m_samples.end(), 0.0f);
+        return;
+    }
+
+    // Frames that line up with the quantum are captured in place, anything else is queued until the mixer takes a frame
+    const bool passthrough = m_reblocker.IsPassthrough();
+    float* samples = passthrough ? m_samples.data() : m_quantumSamples.data();
+    AZStd::fill(samples, samples + bufferSize, 0.0f);
+
+    lab::AudioBus* inputBus = input(0)->isConnected() ? input(0)->bus(r) : nullptr;
+    if (m_passthrough.load(AZStd::memory_order_relaxed))
+    {
+        // No mixer reads the queue yet, so nothing is queued
+        if (outputBus)
+        {
+            RenderPassthrough(r, inputBus, *outputBus, bufferSize);
+        }
+        return;
+    }
+    m_wasPassthrough = false;
+
+    const int numChannels = inputBus ? inputBus->numberOfChannels() : 0;
+    if (numChannels > 0)
+    {
+        const float scale = 1.0f / numChannels;
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            const float* src = inputBus->channel(channel)->data();
+            for (int frame = 0; frame < bufferSize; ++frame)
+            {
+                samples[frame] += src[frame] * scale;
+            }
+        }
+    }
+
+    if (!passthrough)
+    {
+        m_reblocker.GetInput().Write(&samples, 1, bufferSize);
+    }
+}
+
+void SteamAudioSourceTapNode::RenderPassthrough(lab::ContextRenderLock& r, lab::AudioBus* inputBus, lab::AudioBus& outputBus, int bufferSize)
+{
+    // Gains start over whenever the mixer lets go of the source
+    if (!m_wasPassthrough)
+    {
+        m_panner.Reset();
+        m_wasPassthrough = true;
+    }
+
+    if (m_parameters.Read(m_renderParameters))
+    {
+        m_attenuationTable.Build(m_renderParameters.m_attenuation);
+    }
+
+    if (!inputBus || !m_listenerCache)
+    {
+        return;
+    }
+
+    UnspatializedSource source;
+    source.m_position = m_renderParameters.m_position;
+    source.m_distanceModelType = m_renderParameters.m_distanceModelType;
+    source.m_minDistance = m_renderParameters.m_minDistance;
+    source.m_spatialBlend = m_renderParameters.m_spatialBlend;
+    source.m_attenuationTable = &m_attenuationTable;
+
+    const float* inputChannels[UnspatializedPanner::MaxChannels];
+    const int numInputChannels = AZStd::min(inputBus->numberOfChannels(), UnspatializedPanner::MaxChannels);
+    for (int ch = 0; ch < numInputChannels; ++ch)
+    {
+        inputChannels[ch] = inputBus->channel(ch)->data();
+    }
+    float* outputChannels[UnspatializedPanner::MaxChannels];
+    const int numOutputChannels = AZStd::min(outputBus.numberOfChannels(), UnspatializedPanner::MaxChannels);
+    for (int ch = 0; ch < numOutputChannels; ++ch)
+    {
+        outputChannels[ch] = outputBus.channel(ch)->mutableData();
+    }
+
+    m_panner.Render(m_listenerCache->Capture(r).m_coords, source, inputChannels, numInputChannels,
+        outputChannels, numOutputChannels, bufferSize);
+}
+
+void SteamAudioSourceTapNode::ReadFrame()
+{
+    if (m_reblocker.IsPassthrough())
+    {
+        return;
+    }
+
+    ReblockingFifo& fifo = m_reblocker.GetInput();
+    const int frameSize = static_cast<int>(m_samples.size());
+    if (fifo.GetSize() < frameSize)
+    {
+        // Only a tap that missed quanta gets here, it restarts on the grid next quantum
+        AZStd::fill(m_samples.begin(), m_samples.end(), 0.0f);
+        return;
+    }
+
+    float* samples = m_samples.data();
+    fifo.Read(&samples, frameSize);
+}
+
+void SteamAudioSourceTapNode::reset(lab::ContextRenderLock&)
+{
+    AZStd::fill(m_samples.begin(), m_samples.end(), 0.0f);
+    m_reblocker.Reset();
+}
+
+SteamAudioSpatialSource::~SteamAudioSpatialSource()
+{
+
+}
+
+bool SteamAudioSpatialSource::Initialize(lab::AudioContext& ac)
+{
+    const SystemReadiness readiness = TuSteamAudioInterface::Get()->GetReadiness();
+    if (readiness != SystemReadiness::Ready && readiness != SystemReadiness::Initializing)
+    {
+        AZ_Error("SteamAudioSpatialSource", false, "Spatial mixer is not available");
+        return false;
+    }
+
+    m_tap = std::make_shared<SteamAudioSourceTapNode>(ac, TuSteamAudioInterface::Get()->GetAudioSettings().frameSize);
+    PublishTapParameters();
+    if (readiness == SystemReadiness::Ready)
+    {
+        AttachToMixer();
+        if (!m_mixer)
+        {
+            m_tap = nullptr;
+            return false;
+        }
+    }
+    else
+    {
+        m_tap->SetPassthrough(true);
+    }
+
+    Sune::PlayerEffectSpatializationRequestBus::Handler::BusConnect(GetId());
+    Sune::PlayerEffectImGuiRequestBus::Handler::BusConnect(GetId());
+    SteamAudioEffectRequestBus::Handler::BusConnect(GetId());
+    TuSteamAudioNotificationBus::Handler::BusConnect();
+
+    return true;
+}
+
+void SteamAudioSpatialSource::AttachToMixer()
+{
+    SteamAudioSpatialMixerNode* mixer = TuSteamAudioInterface::Get()->GetSpatialMixer();
+    if (!mixer)
+    {
+        AZ_Error("SteamAudioSpatialSource", false, "Spatial mixer is not available");
+        return;
+    }
+
+    m_sourceId = mixer->AddSource(m_tap);
+    if (m_sourceId == InvalidSpatialSourceId)
+    {
+        return;
+    }
+
+    m_mixer = mixer;
+    m_mixer->SetSourceTransform(m_sourceId, m_transform);
+    m_mixer->SetSourceDistanceModel(m_sourceId, m_distanceModel);
+    m_mixer->SetSourceSpatialBlend(m_sourceId, m_spatialBlend);
+    m_mixer->SetSourceMinDistance(m_sourceId, m_minDistance);
+    m_mixer->SetSourceInterpolation(m_sourceId, m_interpolation);
+    if (m_hasAttenuation)
+    {
+        m_mixer->SetSourceAttenuation(m_sourceId, m_attenuation);
+    }
+    m_tap->SetPassthrough(false);
+}
+
+void SteamAudioSpatialSource::DetachFromMixer()
+{
+    if (m_mixer && m_sourceId != InvalidSpatialSourceId)
+    {
+        m_mixer->RemoveSource(m_sourceId);
+    }
+
+    m_sourceId = InvalidSpatialSourceId;
+    m_mixer = nullptr;
+    if (m_tap)
+    {
+        m_tap->SetPassthrough(true);
+    }
+}
+
+void SteamAudioSpatialSource::PublishTapParameters()
+{
+    SpatialSourceParameters parameters;
+    const auto sourcePos = Sune::ToLab(m_transform.GetTranslation());
+    parameters.m_position = IPLVector3{ sourcePos.x, sourcePos.y, sourcePos.z };
+    parameters.m_spatialBlend = m_spatialBlend;
+    parameters.m_interpolation = m_interpolation;
+    parameters.m_distanceModelType = ToDistanceModelType(m_distanceModel);
+    parameters.m_minDistance = m_minDistance;
+    parameters.m_attenuation = m_attenuation;
+    m_tap->SetParameters(parameters);
+}
+
+void SteamAudioSpatialSource::OnReadinessChanged(SystemReadiness readiness)
+{
+    // A source that can't be added keeps passing through
+    if (readiness == SystemReadiness::Ready && m_tap && !m_mixer)
+    {
+        AttachToMixer();
+    }
+    // Broadcast before the system component releases the mixer
+    else if (readiness != SystemReadiness::Ready && m_mixer)
+    {
+        DetachFromMixer();
+    }
+}
+
+void SteamAudioSpatialSource::Shutdown()
+{
+    TuSteamAudioNotificationBus::Handler::BusDisconnect();
+    SteamAudioEffectRequestBus::Handler::BusDisconnect();
+    Sune::PlayerEffectImGuiRequestBus::Handler::BusDisconnect();
+    Sune::PlayerEffectSpatializationRequestBus::Handler::BusDisconnect();
+
+    DetachFromMixer();
+    m_tap = nullptr;
+}
+
+std::shared_ptr<lab::AudioNode> SteamAudioSpatialSource::GetInputNode()
+{
+    return m_tap;
+}
+
+std::shared_ptr<lab::AudioNode> SteamAudioSpatialSource::GetOutputNode()
+{
+    return m_tap;
+}
+
+void SteamAudioSpatialSource::SetTransform(const AZ::Transform& transform)
+{
+    m_transform = transform;
+    PublishTapParameters();
+    if (m_mixer)
+    {
+        m_mixer->SetSourceTransform(m_sourceId, transform);
+    }
+}
+
+void SteamAudioSpatialSource::SetDistanceModel(DistanceModel model)
+{
+    m_distanceModel = model;
+    PublishTapParameters();
+    if (m_mixer)
+    {
+        m_mixer->SetSourceDistanceModel(m_sourceId, model);
+    }
+}
+
+void SteamAudioSpatialSource::SetTuAttenuationSettings(Attenuation::TuAttenuation settings)
+{
+    m_attenuation = settings;
+    m_hasAttenuation = true;
+    PublishTapParameters();
+    if (m_mixer)
+    {
+        m_mixer->SetSourceAttenuation(m_sourceId, settings);
+    }
+}
+
+void SteamAudioSpatialSource::DrawGui()
+{
+    if (!m_mixer)
+        return;
+
+    ImGui::Spacing();
+    ImGui::TextColored(ImVec4(0.3f, 1.0f, 0.5f, 1.0f), "Steam Audio Batched Spatialization:");
+    ImGui::Text("Mixer slot: %d", m_sourceId);
+    ImGui::Text("Active mixer sources: %u", m_mixer->GetActiveSourceCount());
+
+    ImGui::Separator();
+
+    int interpIndex = m_interpolation;
+    const char* interpModes[] = { "Nearest", "Bilinear" };
+    if (ImGui::Combo("HRTF Interpolation", &interpIndex, interpModes, IM_ARRAYSIZE(interpModes)))
+    {
+        m_interpolation = static_cast<IPLHRTFInterpolation>(interpIndex);
+        PublishTapParameters();
+        m_mixer->SetSourceInterpolation(m_sourceId, m_interpolation);
+    }
+
+    float spatialBlend = m_spatialBlend;
+    if (ImGui::SliderFloat("Spatial Blend", &spatialBlend, 0.0f, 1.0f))
+    {
+        m_spatialBlend = spatialBlend;
+        PublishTapParameters();
+        m_mixer->SetSourceSpatialBlend(m_sourceId, spatialBlend);
+    }
+    if (ImGui::IsItemHovered())
+    {
+        ImGui::SetTooltip("0 = Dry (no HRTF), 1 = Fully spatialized");
+    }
+
+    if (m_distanceModel == DistanceModel::InverseDistance)
+    {
+        float minDistance = m_minDistance;
+        if (ImGui::DragFloat("Min Distance", &minDistance, 0.1f, 0.1f, 100.0f))
+        {
+            m_minDistance = minDistance;
+            PublishTapParameters();
+            m_mixer->SetSourceMinDistance(m_sourceId, minDistance);
+        }
+    }
+}
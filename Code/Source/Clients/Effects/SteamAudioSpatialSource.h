@@ -0,0 +1,135 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "Sune/PlayerAudioEffect.h"
+#include "TuSteamAudio/Types.h"
+#include "TuSteamAudio/TuSteamAudioBus.h"
+#include "SteamAudioSpatialMixer.h"
+#include "ReblockingFifo.h"
+#include "TripleBuffer.h"
+#include "UnspatializedPanner.h"
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace TuSteamAudio
+{
+    //! Captures a player's signal (downmixed to mono) for the spatial mixer and outputs silence.
+    //! Until the mixer takes it, the input is panned plainly to the stereo output the way SteamAudioHrtf does.
+    //! The mixer pulls taps itself, so the capture always belongs to the quantum being mixed.
+    //! When Steam Audio's frame doesn't line up with the quantum the capture is queued on the same frame grid as the mixer.
+    class SteamAudioSourceTapNode : public lab::AudioNode
+    {
+    public:
+        SteamAudioSourceTapNode(lab::AudioContext& ac, int frameSize);
+        virtual ~SteamAudioSourceTapNode();
+
+        static const char* static_name() { return "SteamAudioSourceTap"; }
+        const char* name() const override { return static_name(); }
+        static lab::AudioNodeDescriptor* desc();
+
+        void process(lab::ContextRenderLock&, int bufferSize) override;
+        void reset(lab::ContextRenderLock&) override;
+
+        //! Render thread, the frame the mixer is rendering.
+        const float* GetSamples() const { return m_samples.data(); }
+        //! Render thread. Moves the next queued frame into GetSamples(), the mixer calls it once per frame it renders.
+        void ReadFrame();
+        //! Any thread. Outputs the input panned plainly instead of silence, for a source the mixer doesn't take yet.
+        void SetPassthrough(bool passthrough) { m_passthrough.store(passthrough, AZStd::memory_order_relaxed); }
+        //! Game thread. What the passthrough pans with, the mixer gets its own copy.
+        void SetParameters(const SpatialSourceParameters& parameters) { m_parameters.Write(parameters); }
+
+    protected:
+        double tailTime(lab::ContextRenderLock& r) const override { return 0; }
+        double latencyTime(lab::ContextRenderLock& r) const override { return 0; }
+        // Always capture, a silent player must still overwrite last quantum's samples.
+        bool propagatesSilence(lab::ContextRenderLock& r) const override { return false; }
+
+    private:
+        void RenderPassthrough(lab::ContextRenderLock& r, lab::AudioBus* inputBus, lab::AudioBus& outputBus, int bufferSize);
+
+        AZStd::vector<float> m_samples;
+        //Downmix of the quantum on its way into the reblocker
+        AZStd::vector<float> m_quantumSamples;
+        FrameReblocker m_reblocker;
+        AZStd::atomic_bool m_passthrough{ false };
+
+        //Passthrough, settings handed over by the game thread and what the render thread pans with
+        TripleBuffer<SpatialSourceParameters> m_parameters;
+        SpatialSourceParameters m_renderParameters;
+        Attenuation::AttenuationTable m_attenuationTable;
+        UnspatializedPanner m_panner;
+        ListenerCache* m_listenerCache = nullptr;
+        //Render thread, the last quantum was passed through
+        bool m_wasPassthrough = false;
+    };
+
+    //! Lightweight alternative to SteamAudioHrtf, registers the player as a source of the
+    //! system wide SteamAudioSpatialMixerNode instead of running its own spatializer.
+    //! Created before the system is Ready, the tap pans the input plainly with distance gain until the mixer exists.
+    class SteamAudioSpatialSource
+        : public Sune::IPlayerAudioEffect
+        , public Sune::PlayerEffectSpatializationRequestBus::Handler
+        , public Sune::PlayerEffectImGuiRequestBus::Handler
+        , public SteamAudioEffectRequestBus::Handler
+        , public TuSteamAudioNotificationBus::Handler
+    {
+    public:
+        constexpr static AZ::Crc32 RegisterName = AZ_CRC_CE("SteamAudioSpatialSource");
+        ~SteamAudioSpatialSource() override;
+        virtual bool Initialize(lab::AudioContext& ac) override;
+        virtual void Shutdown() override;
+
+        std::shared_ptr<lab::AudioNode> GetInputNode() override;
+        std::shared_ptr<lab::AudioNode> GetOutputNode() override;
+
+        const char* GetEffectName() const override
+        {
+            return "SteamAudioSpatialSource";
+        }
+
+        Sune::PlayerEffectOrder GetProcessingOrder() const override
+        {
+            return Sune::PlayerEffectOrder::Spatializer;
+        }
+
+        // PlayerEffectSpatializationRequestBus
+        void SetTransform(const AZ::Transform& transform) override;
+
+        void SetDistanceModel(DistanceModel model) override;
+        void SetTuAttenuationSettings(Attenuation::TuAttenuation settings) override;
+
+        void DrawGui() override;
+
+        // TuSteamAudioNotificationBus
+        void OnReadinessChanged(SystemReadiness readiness) override;
+
+    private:
+        //! Adds the tap to the mixer and replays what was set while it couldn't be.
+        void AttachToMixer();
+        //! Hands the slot back and passes the tap through again, the mixer is about to go away.
+        void DetachFromMixer();
+        //! Hands the game side copy to the tap, which pans with it while it passes through.
+        void PublishTapParameters();
+
+        std::shared_ptr<SteamAudioSourceTapNode> m_tap = {};
+        //! Owned by the system component, only valid while it is Ready. Cleared when it stops being.
+        SteamAudioSpatialMixerNode* m_mixer = nullptr;
+        SpatialSourceId m_sourceId = InvalidSpatialSourceId;
+
+        // Game side copy, replayed on the mixer once it takes the source
+        AZ::Transform m_transform = AZ::Transform::CreateIdentity();
+        Attenuation::TuAttenuation m_attenuation;
+        bool m_hasAttenuation = false;
+        DistanceModel m_distanceModel = DistanceModel::Default;
+        float m_spatialBlend = 1.0f;
+        float m_minDistance = 1.0f;
+        IPLHRTFInterpolation m_interpolation = IPL_HRTFINTERPOLATION_BILINEAR;
+    };
+} // TuSteamAudio
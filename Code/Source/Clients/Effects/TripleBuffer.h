@@ -0,0 +1,50 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/parallel/atomic.h>
+
+namespace TuSteamAudio
+{
+    //! Wait free hand over of a whole value from one writer thread to one reader thread.
+    //! Each side owns one slot, the third is swapped between them with a single atomic exchange,
+    //! so neither side ever copies a slot the other one is using and values of any size arrive whole.
+    template<typename T>
+    class TripleBuffer
+    {
+    public:
+        //! Writer thread only. Replaces whatever the reader hasn't picked up yet.
+        void Write(const T& value)
+        {
+            m_values[m_writeSlot] = value;
+            m_writeSlot = m_shared.exchange(m_writeSlot | NewValueBit, AZStd::memory_order_acq_rel) & SlotMask;
+        }
+
+        //! Reader thread only. Returns false and leaves out untouched when nothing new was written.
+        bool Read(T& out)
+        {
+            if ((m_shared.load(AZStd::memory_order_relaxed) & NewValueBit) == 0)
+            {
+                return false;
+            }
+
+            m_readSlot = m_shared.exchange(m_readSlot, AZStd::memory_order_acq_rel) & SlotMask;
+            out = m_values[m_readSlot];
+            return true;
+        }
+
+    private:
+        static constexpr AZ::u32 SlotMask = 3;
+        static constexpr AZ::u32 NewValueBit = 4;
+
+        T m_values[3] = {};
+        AZ::u32 m_writeSlot = 0;
+        AZ::u32 m_readSlot = 1;
+        AZStd::atomic<AZ::u32> m_shared{ 2 };
+    };
+} // TuSteamAudio
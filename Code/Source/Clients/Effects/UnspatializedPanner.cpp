@@ -0,0 +1,77 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "UnspatializedPanner.h"
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace TuSteamAudio;
+
+void UnspatializedPanner::Render(const IPLCoordinateSpace3& listener, const UnspatializedSource& source,
+    const float* const* input, int numInputChannels, float* const* output, int numOutputChannels, int numSamples)
+{
+    const AZ::Vector3 toSource(source.m_position.x - listener.origin.x, source.m_position.y - listener.origin.y,
+        source.m_position.z - listener.origin.z);
+    const float distance = toSource.GetLength();
+    const AZ::Vector3 right(listener.right.x, listener.right.y, listener.right.z);
+    const float pan = distance > 0.0f ? toSource.Dot(right) / distance : 0.0f;
+
+    float distanceAttenuation = 1.0f;
+    if (source.m_distanceModelType == IPL_DISTANCEATTENUATIONTYPE_CALLBACK)
+    {
+        distanceAttenuation = source.m_attenuationTable ? source.m_attenuationTable->Lookup(distance) : 1.0f;
+    }
+    else
+    {
+        const float minDistance = source.m_distanceModelType == IPL_DISTANCEATTENUATIONTYPE_INVERSEDISTANCE ? source.m_minDistance : 1.0f;
+        distanceAttenuation = 1.0f / AZStd::max(distance, AZStd::max(minDistance, AZ::Constants::FloatEpsilon));
+    }
+
+    // Same blend as the spatialized path, the dry share keeps the input's own channels
+    const float spatialBlend = source.m_spatialBlend;
+    const float distanceGain = (1.0f - spatialBlend) + spatialBlend * distanceAttenuation;
+    const float wetBlend = (spatialBlend == 1.0f && distanceAttenuation == 0.0f) ? 1.0f : spatialBlend * distanceAttenuation / distanceGain;
+    float panGains[2];
+    ConstantPowerPan(pan, panGains);
+
+    numInputChannels = AZStd::min(numInputChannels, MaxChannels);
+    const float downmixScale = 1.0f / static_cast<float>(AZStd::max(numInputChannels, 1));
+
+    // Gains ramp across the block, a step per quantum would zipper on a moving source
+    const float step = 1.0f / static_cast<float>(numSamples);
+    const float dryTo = distanceGain * (1.0f - wetBlend);
+    const float dryFrom = m_dryGain < 0.0f ? dryTo : m_dryGain;
+    for (int ch = 0; ch < numOutputChannels; ++ch)
+    {
+        const int side = AZStd::min(ch, 1);
+        const float wetTo = distanceGain * wetBlend * panGains[side];
+        const float wetFrom = m_wetGains[side] < 0.0f ? wetTo : m_wetGains[side];
+        const float* dry = numInputChannels > 0 ? input[AZStd::min(ch, numInputChannels - 1)] : nullptr;
+        float* dst = output[ch];
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float mono = 0.0f;
+            for (int inCh = 0; inCh < numInputChannels; ++inCh)
+            {
+                mono += input[inCh][i];
+            }
+
+            const float t = static_cast<float>(i + 1) * step;
+            const float wetGain = wetFrom + (wetTo - wetFrom) * t;
+            const float dryGain = dryFrom + (dryTo - dryFrom) * t;
+            dst[i] = mono * downmixScale * wetGain + (dry ? dry[i] * dryGain : 0.0f);
+        }
+        m_wetGains[side] = wetTo;
+    }
+    m_dryGain = dryTo;
+}
+
+void UnspatializedPanner::Reset()
+{
+    m_wetGains[0] = m_wetGains[1] = -1.0f;
+    m_dryGain = -1.0f;
+}
@@ -0,0 +1,56 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "phonon.h"
+#include "TuSteamAudio/AttenuationTable.h"
+
+#include <AzCore/Math/MathUtils.h>
+#include <cmath>
+
+namespace TuSteamAudio
+{
+    //! Constant power gains for the left and right ear, a quarter circle from pan -1 hard left to 1 hard right.
+    inline void ConstantPowerPan(float pan, float (&gains)[2])
+    {
+        const float angle = (AZ::GetClamp(pan, -1.0f, 1.0f) + 1.0f) * AZ::Constants::QuarterPi;
+        gains[0] = std::cos(angle);
+        gains[1] = std::sin(angle);
+    }
+
+    //! What an UnspatializedPanner renders a source with.
+    struct UnspatializedSource
+    {
+        //! Same space as the listener
+        IPLVector3 m_position = { 0.0f, 0.0f, 0.0f };
+        IPLDistanceAttenuationModelType m_distanceModelType = IPL_DISTANCEATTENUATIONTYPE_DEFAULT;
+        float m_minDistance = 1.0f;
+        float m_spatialBlend = 1.0f;
+        //! Only read with the callback model
+        const Attenuation::AttenuationTable* m_attenuationTable = nullptr;
+    };
+
+    //! Stands in for the HRTF while a source has no spatializer yet: a constant power pan on its left/right offset
+    //! and the distance gain Steam Audio's models would give. The dry share of the spatial blend keeps the input's
+    //! own channels. Render thread only, gains ramp across each block from where the last one ended.
+    class UnspatializedPanner
+    {
+    public:
+        static constexpr int MaxChannels = 16;
+
+        //! Overwrites output. Takes at most MaxChannels of input.
+        void Render(const IPLCoordinateSpace3& listener, const UnspatializedSource& source,
+            const float* const* input, int numInputChannels, float* const* output, int numOutputChannels, int numSamples);
+        //! The next block starts at its gains instead of ramping to them.
+        void Reset();
+
+    private:
+        //Gains the last block reached, negative until one was rendered
+        float m_wetGains[2] = { -1.0f, -1.0f };
+        float m_dryGain = -1.0f;
+    };
+} // TuSteamAudio
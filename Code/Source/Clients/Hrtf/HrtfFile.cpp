@@ -0,0 +1,125 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "HrtfFile.h"
+
+using namespace TuSteamAudio;
+
+namespace
+{
+    size_t GetContentSize(const HrtfFile::Header& header)
+    {
+        return header.m_rateCount * sizeof(HrtfFile::Rate) + header.m_payloadSize;
+    }
+}
+
+bool HrtfFile::Serialize(const AZStd::vector<Rate>& rates, const void* sofaData, size_t sofaSize, AZStd::vector<AZ::u8>& out)
+{
+    if (rates.empty() || !sofaData || sofaSize == 0)
+    {
+        AZ_Error("HrtfFile", false, "An HRTF product needs at least one sample rate and a SOFA payload");
+        return false;
+    }
+
+    Header header;
+    header.m_rateCount = static_cast<AZ::u32>(rates.size());
+    header.m_payloadSize = sofaSize;
+
+    const size_t tableSize = rates.size() * sizeof(Rate);
+    out.resize(sizeof(Header) + tableSize + sofaSize);
+    AZ::u8* content = out.data() + sizeof(Header);
+    memcpy(content, rates.data(), tableSize);
+    memcpy(content + tableSize, sofaData, sofaSize);
+
+    header.m_contentHash = AcousticSceneFile::HashPayload(content, tableSize + sofaSize);
+    memcpy(out.data(), &header, sizeof(Header));
+    return true;
+}
+
+bool HrtfFile::Validate(const void* data, size_t size, Header* outHeader)
+{
+    if (!data || size < sizeof(Header))
+    {
+        return false;
+    }
+
+    Header header;
+    memcpy(&header, data, sizeof(Header));
+
+    if (header.m_magic != Header::Magic || header.m_version != Header::CurrentVersion)
+    {
+        AZ_Warning("HrtfFile", false, "Not an HRTF product, or an unsupported version");
+        return false;
+    }
+
+    if (header.m_steamAudioVersion != STEAMAUDIO_VERSION)
+    {
+        AZ_Warning("HrtfFile", false, "HRTF was built with a different Steam Audio version, rebuild it");
+        return false;
+    }
+
+    if (header.m_rateCount == 0 || GetContentSize(header) != size - sizeof(Header))
+    {
+        AZ_Warning("HrtfFile", false, "HRTF product is truncated");
+        return false;
+    }
+
+    const AZ::u8* content = static_cast<const AZ::u8*>(data) + sizeof(Header);
+    if (AcousticSceneFile::HashPayload(content, GetContentSize(header)) != header.m_contentHash)
+    {
+        AZ_Warning("HrtfFile", false, "HRTF product is corrupt");
+        return false;
+    }
+
+    if (outHeader)
+    {
+        *outHeader = header;
+    }
+    return true;
+}
+
+IPLHRTF HrtfFile::Create(IPLContext context, IPLAudioSettings& audioSettings, const void* data, size_t size)
+{
+    Header header;
+    if (!Validate(data, size, &header))
+    {
+        return nullptr;
+    }
+
+    const AZ::u8* content = static_cast<const AZ::u8*>(data) + sizeof(Header);
+    const size_t tableSize = header.m_rateCount * sizeof(Rate);
+
+    IPLHRTFSettings hrtfSettings{};
+    hrtfSettings.type = IPL_HRTFTYPE_SOFA;
+    // Steam Audio copies what it needs out of the SOFA data while creating the HRTF
+    hrtfSettings.sofaData = content + tableSize;
+    hrtfSettings.sofaDataSize = static_cast<IPLint32>(header.m_payloadSize);
+    hrtfSettings.volume = 1.0f;
+    hrtfSettings.normType = IPL_HRTFNORMTYPE_RMS;
+
+    for (AZ::u32 i = 0; i < header.m_rateCount; ++i)
+    {
+        Rate rate;
+        memcpy(&rate, content + i * sizeof(Rate), sizeof(Rate));
+        if (rate.m_samplingRate == static_cast<AZ::u32>(audioSettings.samplingRate))
+        {
+            hrtfSettings.volume = rate.m_volume;
+            hrtfSettings.normType = IPL_HRTFNORMTYPE_NONE;
+            break;
+        }
+    }
+    AZ_Warning("HrtfFile", hrtfSettings.normType == IPL_HRTFNORMTYPE_NONE,
+        "HRTF wasn't built for %d Hz, add it to /TuSteamAudio/Hrtf/TargetSampleRates", audioSettings.samplingRate);
+
+    IPLHRTF hrtf = nullptr;
+    IPLerror err = iplHRTFCreate(context, &audioSettings, &hrtfSettings, &hrtf);
+    if (err != IPL_STATUS_SUCCESS)
+    {
+        AZ_Error("HrtfFile", false, "Failed to create HRTF from SOFA data");
+        return nullptr;
+    }
+    return hrtf;
+}
@@ -0,0 +1,55 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "Clients/Scene/AcousticSceneFile.h"
+
+#include <AzCore/std/containers/vector.h>
+
+namespace TuSteamAudio
+{
+    namespace HrtfFile
+    {
+        //! Measured HRTFs in the AES69 SOFA format, picked up by the asset processor.
+        static constexpr const char* SourceExtension = "sofa";
+        //! Built product, named by /TuSteamAudio/Hrtf/Path.
+        static constexpr const char* ProductExtension = "sahrtf";
+
+        //! Followed by m_rateCount Rates, then the SOFA payload.
+        struct Header
+        {
+            static constexpr AZ::u32 Magic = 0x53415448; // "HTAS"
+            static constexpr AZ::u32 CurrentVersion = 1;
+
+            AZ::u32 m_magic = Magic;
+            AZ::u32 m_version = CurrentVersion;
+            AZ::u32 m_steamAudioVersion = STEAMAUDIO_VERSION;
+            AZ::u32 m_rateCount = 0;
+            AZ::u64 m_payloadSize = 0;
+            //! Sha1 of the rate table and payload together.
+            AcousticSceneFile::ContentHash m_contentHash = {};
+        };
+
+        //! What the builder measured at one target sample rate.
+        struct Rate
+        {
+            AZ::u32 m_samplingRate = 0;
+            //! Linear gain that brings the HRTF's average loudness in line with Steam Audio's default HRTF.
+            float m_volume = 1.0f;
+        };
+
+        bool Serialize(const AZStd::vector<Rate>& rates, const void* sofaData, size_t sofaSize, AZStd::vector<AZ::u8>& out);
+
+        //! Checks magic, versions, size and hash. Returns the header through outHeader when valid.
+        bool Validate(const void* data, size_t size, Header* outHeader = nullptr);
+
+        //! Creates the HRTF from a product in memory, the buffer is not referenced afterwards.
+        //! Uses the gain measured for audioSettings' sample rate, or Steam Audio's own RMS normalization when the
+        //! product wasn't built for it. Null on failure.
+        IPLHRTF Create(IPLContext context, IPLAudioSettings& audioSettings, const void* data, size_t size);
+    } // HrtfFile
+} // TuSteamAudio
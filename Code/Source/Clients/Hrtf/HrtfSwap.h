@@ -0,0 +1,81 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "phonon.h"
+
+#include <AzCore/base.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/algorithm.h>
+
+namespace TuSteamAudio
+{
+    //! Where one client is in moving its effects over to a new HRTF.
+    enum class HrtfSwapState : AZ::u8
+    {
+        Idle,
+        Offered, // Set by the game thread, effects for the new HRTF are ready to be taken
+        Fading,  // Set by the render thread, old and new effects both render until the crossfade ends
+        Retired  // Set by the render thread, the game thread may now release the old effects
+    };
+
+    //! Anything holding effects bound to the HRTF. Registered with TuSteamAudioRequests, which calls
+    //! UpdateHrtf every tick so a client always ends up on the current HRTF.
+    class HrtfClient
+    {
+    public:
+        virtual ~HrtfClient() = default;
+
+        //! Game thread. Releases what the render thread faded away from, then offers effects bound to hrtf if the
+        //! client isn't on it yet. An offer the render thread hasn't taken is withdrawn and replaced, one being faded
+        //! to is left alone until the next tick.
+        virtual void UpdateHrtf(IPLHRTF hrtf) = 0;
+    };
+
+    //! Render thread crossfade from the output of effects bound to the old HRTF to the output of those bound to the new one.
+    //! The new effects start without any convolution history, so they render for warmup samples before they are heard.
+    class HrtfCrossfade
+    {
+    public:
+        void Start(int warmup, int length)
+        {
+            m_position = 0;
+            m_warmup = warmup;
+            m_length = AZStd::max(length, 1);
+        }
+
+        bool IsActive() const { return m_position < m_warmup + m_length; }
+
+        //! Fades to in over from. Doesn't move the fade on, every buffer of the same frame fades the same way.
+        void Apply(const IPLAudioBuffer& from, IPLAudioBuffer& to) const
+        {
+            const float step = 1.0f / static_cast<float>(m_length);
+            for (int ch = 0; ch < to.numChannels; ++ch)
+            {
+                const float* src = from.data[AZStd::min(ch, from.numChannels - 1)];
+                float* dst = to.data[ch];
+                for (int i = 0; i < to.numSamples; ++i)
+                {
+                    const float gain = AZ::GetClamp(static_cast<float>(m_position + i + 1 - m_warmup) * step, 0.0f, 1.0f);
+                    dst[i] = src[i] + (dst[i] - src[i]) * gain;
+                }
+            }
+        }
+
+        //! Returns true once the new effects are all that is heard.
+        bool Advance(int numSamples)
+        {
+            m_position = AZStd::min(m_position + numSamples, m_warmup + m_length);
+            return !IsActive();
+        }
+
+    private:
+        int m_position = 0;
+        int m_warmup = 0;
+        int m_length = 1;
+    };
+} // TuSteamAudio
@@ -0,0 +1,350 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "PhononAllocator.h"
+
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace TuSteamAudio;
+
+namespace
+{
+    // Sits right in front of every pointer handed out, Free finds its way back from it
+    struct BlockHeader
+    {
+        AZ::u64 m_size;
+        AZ::u32 m_block;
+        AZ::u16 m_offset;
+        AZ::u8 m_sizeClass;
+        AZ::u8 m_category;
+    };
+    static_assert(sizeof(BlockHeader) == 16, "BlockHeader must keep 16 byte alignment of what follows it");
+
+    constexpr AZ::u8 LargeSizeClass = 0xFF;
+    constexpr AZ::u64 IndexMask = 0xFFFFFFFFull;
+    constexpr AZ::u64 TagIncrement = 1ull << 32;
+
+    AZ::IAllocator& GetFallback()
+    {
+        return AZ::AllocatorInstance<SteamAudioAllocator>::Get();
+    }
+}
+
+struct PhononAllocator::ThreadCache
+{
+    ~ThreadCache()
+    {
+        // Blocks go back to the shared stacks, nothing else would ever hand them out again
+        if (m_owner && m_generation == m_owner->m_generation.load(AZStd::memory_order_acquire))
+        {
+            for (int sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+            {
+                for (AZ::u32 i = 0; i < m_count[sizeClass]; ++i)
+                {
+                    m_owner->Push(sizeClass, m_blocks[sizeClass][i]);
+                }
+            }
+        }
+    }
+
+    PhononAllocator* m_owner = nullptr;
+    AZ::u32 m_generation = 0;
+    AZStd::array<AZ::u32, SizeClassCount> m_count{};
+    AZStd::array<AZStd::array<AZ::u32, ThreadCacheSize>, SizeClassCount> m_blocks;
+};
+
+void* PhononAllocator::Allocate(size_t size, size_t alignment)
+{
+    // The header fits in front of the first aligned address past it
+    const size_t offset = AZStd::max(alignment, sizeof(BlockHeader));
+    AZ_Assert(offset <= 0xFFFF, "Steam Audio asked for %zu byte alignment", alignment);
+
+    int sizeClass = alignment <= MaxPoolAlignment ? GetSizeClass(size + offset) : -1;
+    AZ::u32 block = 0;
+    char* start = nullptr;
+    if (sizeClass >= 0 && AllocateBlock(sizeClass, block))
+    {
+        start = GetBlock(sizeClass, block);
+    }
+    else
+    {
+        start = static_cast<char*>(GetFallback().allocate(size + offset, offset));
+        if (!start)
+        {
+            return nullptr;
+        }
+        sizeClass = LargeSizeClass;
+    }
+
+    const PhononAllocationCategory category = PhononAllocationScope::GetCurrent();
+    char* ptr = start + offset;
+    BlockHeader* header = reinterpret_cast<BlockHeader*>(ptr) - 1;
+    header->m_size = size;
+    header->m_block = block;
+    header->m_offset = static_cast<AZ::u16>(offset);
+    header->m_sizeClass = static_cast<AZ::u8>(sizeClass);
+    header->m_category = static_cast<AZ::u8>(category);
+
+    RecordAllocation(category, size);
+    return ptr;
+}
+
+void PhononAllocator::Free(void* ptr)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    const BlockHeader header = *(static_cast<const BlockHeader*>(ptr) - 1);
+    RecordFree(static_cast<PhononAllocationCategory>(header.m_category), header.m_size);
+
+    if (header.m_sizeClass == LargeSizeClass)
+    {
+        GetFallback().deallocate(static_cast<char*>(ptr) - header.m_offset);
+        return;
+    }
+    FreeBlock(header.m_sizeClass, header.m_block);
+}
+
+PhononAllocationStats PhononAllocator::GetStats(PhononAllocationCategory category) const
+{
+    const CategoryStats& stats = m_stats[static_cast<int>(category)];
+    PhononAllocationStats result;
+    result.m_liveBytes = stats.m_liveBytes.load(AZStd::memory_order_relaxed);
+    result.m_peakBytes = stats.m_peakBytes.load(AZStd::memory_order_relaxed);
+    result.m_allocations = stats.m_allocations.load(AZStd::memory_order_relaxed);
+    result.m_frees = stats.m_frees.load(AZStd::memory_order_relaxed);
+    return result;
+}
+
+bool PhononAllocator::Release()
+{
+    for (const CategoryStats& stats : m_stats)
+    {
+        if (stats.m_liveBytes.load(AZStd::memory_order_acquire) != 0)
+        {
+            return false;
+        }
+    }
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_growMutex);
+    m_generation.fetch_add(1, AZStd::memory_order_acq_rel);
+    for (SizeClass& sizeClass : m_sizeClasses)
+    {
+        const AZ::u32 slabCount = sizeClass.m_slabCount.load(AZStd::memory_order_acquire);
+        for (AZ::u32 slab = 0; slab < slabCount; ++slab)
+        {
+            GetFallback().deallocate(sizeClass.m_slabs[slab].exchange(nullptr, AZStd::memory_order_acq_rel));
+        }
+        sizeClass.m_slabCount.store(0, AZStd::memory_order_release);
+        sizeClass.m_head.store(0, AZStd::memory_order_release);
+    }
+    m_reservedBytes.store(0, AZStd::memory_order_relaxed);
+    return true;
+}
+
+int PhononAllocator::GetSizeClass(size_t blockSize)
+{
+    if (blockSize > MaxBlockSize)
+    {
+        return -1;
+    }
+
+    int sizeClass = 0;
+    while (GetBlockSize(sizeClass) < blockSize)
+    {
+        ++sizeClass;
+    }
+    return sizeClass;
+}
+
+char* PhononAllocator::GetBlock(int sizeClass, AZ::u32 block) const
+{
+    const AZ::u32 blocksPerSlab = GetBlocksPerSlab(sizeClass);
+    char* slab = m_sizeClasses[sizeClass].m_slabs[block / blocksPerSlab].load(AZStd::memory_order_acquire);
+    return slab + static_cast<size_t>(block % blocksPerSlab) * GetBlockSize(sizeClass);
+}
+
+AZStd::atomic<AZ::u32>& PhononAllocator::GetLink(int sizeClass, AZ::u32 block) const
+{
+    // A free block's first bytes hold the next free block, encoded like the head
+    return *reinterpret_cast<AZStd::atomic<AZ::u32>*>(GetBlock(sizeClass, block));
+}
+
+bool PhononAllocator::Pop(int sizeClass, AZ::u32& block)
+{
+    AZStd::atomic<AZ::u64>& head = m_sizeClasses[sizeClass].m_head;
+    AZ::u64 current = head.load(AZStd::memory_order_acquire);
+    while ((current & IndexMask) != 0)
+    {
+        const AZ::u32 top = static_cast<AZ::u32>(current & IndexMask) - 1;
+        // May read a block another thread popped meanwhile, the tag then fails the exchange
+        const AZ::u32 next = GetLink(sizeClass, top).load(AZStd::memory_order_relaxed);
+        const AZ::u64 replacement = ((current & ~IndexMask) + TagIncrement) | next;
+        if (head.compare_exchange_weak(current, replacement, AZStd::memory_order_acq_rel, AZStd::memory_order_acquire))
+        {
+            block = top;
+            return true;
+        }
+    }
+    return false;
+}
+
+void PhononAllocator::Push(int sizeClass, AZ::u32 block)
+{
+    AZStd::atomic<AZ::u64>& head = m_sizeClasses[sizeClass].m_head;
+    AZStd::atomic<AZ::u32>& link = GetLink(sizeClass, block);
+    AZ::u64 current = head.load(AZStd::memory_order_relaxed);
+    AZ::u64 replacement;
+    do
+    {
+        link.store(static_cast<AZ::u32>(current & IndexMask), AZStd::memory_order_relaxed);
+        replacement = ((current & ~IndexMask) + TagIncrement) | (static_cast<AZ::u64>(block) + 1);
+    } while (!head.compare_exchange_weak(current, replacement, AZStd::memory_order_release, AZStd::memory_order_relaxed));
+}
+
+bool PhononAllocator::Grow(int sizeClass)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_growMutex);
+
+    SizeClass& pool = m_sizeClasses[sizeClass];
+    if ((pool.m_head.load(AZStd::memory_order_acquire) & IndexMask) != 0)
+    {
+        // Another thread grew it or freed into it while this one waited
+        return true;
+    }
+
+    const AZ::u32 slab = pool.m_slabCount.load(AZStd::memory_order_relaxed);
+    if (slab == MaxSlabsPerClass)
+    {
+        return false;
+    }
+
+    char* memory = static_cast<char*>(GetFallback().allocate(SlabSize, MaxPoolAlignment));
+    if (!memory)
+    {
+        return false;
+    }
+    pool.m_slabs[slab].store(memory, AZStd::memory_order_release);
+    pool.m_slabCount.store(slab + 1, AZStd::memory_order_release);
+    m_reservedBytes.fetch_add(SlabSize, AZStd::memory_order_relaxed);
+
+    // Chain the new blocks together first, then splice the whole chain on with a single exchange
+    const AZ::u32 blocksPerSlab = GetBlocksPerSlab(sizeClass);
+    const AZ::u32 first = slab * blocksPerSlab;
+    const AZ::u32 last = first + blocksPerSlab - 1;
+    for (AZ::u32 block = first; block < last; ++block)
+    {
+        GetLink(sizeClass, block).store(block + 2, AZStd::memory_order_relaxed);
+    }
+
+    AZ::u64 current = pool.m_head.load(AZStd::memory_order_relaxed);
+    AZ::u64 replacement;
+    do
+    {
+        GetLink(sizeClass, last).store(static_cast<AZ::u32>(current & IndexMask), AZStd::memory_order_relaxed);
+        replacement = ((current & ~IndexMask) + TagIncrement) | (static_cast<AZ::u64>(first) + 1);
+    } while (!pool.m_head.compare_exchange_weak(current, replacement, AZStd::memory_order_release, AZStd::memory_order_relaxed));
+    return true;
+}
+
+PhononAllocator::ThreadCache* PhononAllocator::GetThreadCache()
+{
+    static thread_local ThreadCache cache;
+
+    const AZ::u32 generation = m_generation.load(AZStd::memory_order_acquire);
+    if (cache.m_owner == nullptr)
+    {
+        cache.m_owner = this;
+        cache.m_generation = generation;
+    }
+    else if (cache.m_owner != this)
+    {
+        // One allocator per process, a second one just skips the caches
+        return nullptr;
+    }
+    else if (cache.m_generation != generation)
+    {
+        // Everything it held went with the slabs
+        cache.m_count.fill(0);
+        cache.m_generation = generation;
+    }
+    return &cache;
+}
+
+bool PhononAllocator::AllocateBlock(int sizeClass, AZ::u32& block)
+{
+    ThreadCache* cache = GetThreadCache();
+    if (!cache)
+    {
+        return Pop(sizeClass, block) || (Grow(sizeClass) && Pop(sizeClass, block));
+    }
+
+    AZ::u32& count = cache->m_count[sizeClass];
+    if (count == 0)
+    {
+        // Take half a cache at once so the shared stack isn't hit on every allocation
+        while (count < ThreadCacheSize / 2)
+        {
+            AZ::u32 refill;
+            if (!Pop(sizeClass, refill) && !(Grow(sizeClass) && Pop(sizeClass, refill)))
+            {
+                break;
+            }
+            cache->m_blocks[sizeClass][count++] = refill;
+        }
+
+        if (count == 0)
+        {
+            return false;
+        }
+    }
+
+    block = cache->m_blocks[sizeClass][--count];
+    return true;
+}
+
+void PhononAllocator::FreeBlock(int sizeClass, AZ::u32 block)
+{
+    ThreadCache* cache = GetThreadCache();
+    if (!cache)
+    {
+        Push(sizeClass, block);
+        return;
+    }
+
+    AZ::u32& count = cache->m_count[sizeClass];
+    if (count == ThreadCacheSize)
+    {
+        // A thread that only frees, like one tearing sources down, passes its surplus on
+        while (count > ThreadCacheSize / 2)
+        {
+            Push(sizeClass, cache->m_blocks[sizeClass][--count]);
+        }
+    }
+    cache->m_blocks[sizeClass][count++] = block;
+}
+
+void PhononAllocator::RecordAllocation(PhononAllocationCategory category, AZ::u64 size)
+{
+    CategoryStats& stats = m_stats[static_cast<int>(category)];
+    stats.m_allocations.fetch_add(1, AZStd::memory_order_relaxed);
+    const AZ::u64 live = stats.m_liveBytes.fetch_add(size, AZStd::memory_order_relaxed) + size;
+
+    AZ::u64 peak = stats.m_peakBytes.load(AZStd::memory_order_relaxed);
+    while (live > peak && !stats.m_peakBytes.compare_exchange_weak(peak, live, AZStd::memory_order_relaxed))
+    {
+    }
+}
+
+void PhononAllocator::RecordFree(PhononAllocationCategory category, AZ::u64 size)
+{
+    CategoryStats& stats = m_stats[static_cast<int>(category)];
+    stats.m_frees.fetch_add(1, AZStd::memory_order_relaxed);
+    stats.m_liveBytes.fetch_sub(size, AZStd::memory_order_relaxed);
+}
@@ -0,0 +1,95 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <TuSteamAudio/Allocators.h>
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace TuSteamAudio
+{
+    //! What iplContextCreate allocates through. Requests up to MaxBlockSize come from power of two size classes,
+    //! each a lock-free stack of blocks carved out of slabs, with a small per thread cache in front of it.
+    //! Freeing never takes a lock, allocating only does when a size class has to grow by a slab.
+    //! Anything larger or more aligned than the pools handle goes to SteamAudioAllocator.
+    class PhononAllocator
+    {
+    public:
+        static constexpr int SizeClassCount = 12;
+        static constexpr size_t MinBlockSize = 32;
+        static constexpr size_t MaxBlockSize = MinBlockSize << (SizeClassCount - 1);
+        //! Slabs are aligned to this, so is every block of at least this size.
+        static constexpr size_t MaxPoolAlignment = 64;
+        static constexpr size_t SlabSize = 256 * 1024;
+        static constexpr AZ::u32 MaxSlabsPerClass = 64;
+        //! Blocks a thread keeps per size class before handing half of them back.
+        static constexpr AZ::u32 ThreadCacheSize = 32;
+
+        //! Any thread. Aligned to alignment, which Steam Audio always passes as a power of two.
+        void* Allocate(size_t size, size_t alignment);
+        //! Any thread, never locks for pooled blocks.
+        void Free(void* ptr);
+
+        PhononAllocationStats GetStats(PhononAllocationCategory category) const;
+        //! Bytes held in slabs, whether handed out or not.
+        AZ::u64 GetReservedBytes() const { return m_reservedBytes.load(AZStd::memory_order_relaxed); }
+
+        //! Game thread. Returns every slab to SteamAudioAllocator, but only once nothing is live any more.
+        //! Threads must be done with Steam Audio, blocks sitting in their caches are dropped.
+        bool Release();
+
+    private:
+        struct SizeClass
+        {
+            //! (tag << 32) | (block + 1), 0 when empty. The tag changes on every update so a stale head can't be swapped back in.
+            AZStd::atomic<AZ::u64> m_head{ 0 };
+            AZStd::array<AZStd::atomic<char*>, MaxSlabsPerClass> m_slabs{};
+            AZStd::atomic<AZ::u32> m_slabCount{ 0 };
+        };
+
+        struct CategoryStats
+        {
+            AZStd::atomic<AZ::u64> m_liveBytes{ 0 };
+            AZStd::atomic<AZ::u64> m_peakBytes{ 0 };
+            AZStd::atomic<AZ::u64> m_allocations{ 0 };
+            AZStd::atomic<AZ::u64> m_frees{ 0 };
+        };
+
+        struct ThreadCache;
+
+        static int GetSizeClass(size_t blockSize);
+        static size_t GetBlockSize(int sizeClass) { return MinBlockSize << sizeClass; }
+        static AZ::u32 GetBlocksPerSlab(int sizeClass) { return static_cast<AZ::u32>(SlabSize / GetBlockSize(sizeClass)); }
+
+        char* GetBlock(int sizeClass, AZ::u32 block) const;
+        AZStd::atomic<AZ::u32>& GetLink(int sizeClass, AZ::u32 block) const;
+
+        //! Lock-free stack of free blocks per size class.
+        bool Pop(int sizeClass, AZ::u32& block);
+        void Push(int sizeClass, AZ::u32 block);
+        //! Adds a slab's worth of blocks to the stack, false once the class is at MaxSlabsPerClass.
+        bool Grow(int sizeClass);
+
+        //! The calling thread's cache first, the shared stack when it runs dry or overflows.
+        bool AllocateBlock(int sizeClass, AZ::u32& block);
+        void FreeBlock(int sizeClass, AZ::u32 block);
+        ThreadCache* GetThreadCache();
+
+        void RecordAllocation(PhononAllocationCategory category, AZ::u64 size);
+        void RecordFree(PhononAllocationCategory category, AZ::u64 size);
+
+        AZStd::array<SizeClass, SizeClassCount> m_sizeClasses;
+        AZStd::array<CategoryStats, PhononAllocationCategoryCount> m_stats;
+        AZStd::atomic<AZ::u64> m_reservedBytes{ 0 };
+        //! Bumped by Release, thread caches from before it are stale.
+        AZStd::atomic<AZ::u32> m_generation{ 0 };
+        AZStd::mutex m_growMutex;
+    };
+} // TuSteamAudio
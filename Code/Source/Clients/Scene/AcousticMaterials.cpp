@@ -0,0 +1,53 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "AcousticMaterials.h"
+
+#include <AzCore/StringFunc/StringFunc.h>
+
+using namespace TuSteamAudio;
+
+namespace
+{
+    struct AcousticMaterialPreset
+    {
+        const char* m_name;
+        IPLMaterial m_material;
+    };
+
+    // Absorption and transmission are low/mid/high bands
+    constexpr AcousticMaterialPreset Presets[] = {
+        { "Generic",  { { 0.10f, 0.20f, 0.30f }, 0.05f, { 0.100f, 0.050f, 0.030f } } },
+        { "Brick",    { { 0.03f, 0.04f, 0.07f }, 0.05f, { 0.015f, 0.015f, 0.015f } } },
+        { "Concrete", { { 0.05f, 0.07f, 0.08f }, 0.05f, { 0.015f, 0.002f, 0.001f } } },
+        { "Ceramic",  { { 0.01f, 0.02f, 0.02f }, 0.05f, { 0.060f, 0.044f, 0.011f } } },
+        { "Gravel",   { { 0.60f, 0.70f, 0.80f }, 0.05f, { 0.031f, 0.012f, 0.008f } } },
+        { "Carpet",   { { 0.24f, 0.69f, 0.73f }, 0.05f, { 0.020f, 0.005f, 0.003f } } },
+        { "Glass",    { { 0.06f, 0.03f, 0.02f }, 0.05f, { 0.060f, 0.044f, 0.011f } } },
+        { "Plaster",  { { 0.12f, 0.06f, 0.04f }, 0.05f, { 0.056f, 0.056f, 0.004f } } },
+        { "Wood",     { { 0.11f, 0.07f, 0.06f }, 0.05f, { 0.070f, 0.014f, 0.005f } } },
+        { "Metal",    { { 0.20f, 0.07f, 0.06f }, 0.05f, { 0.200f, 0.025f, 0.010f } } },
+        { "Rock",     { { 0.13f, 0.20f, 0.24f }, 0.05f, { 0.015f, 0.002f, 0.001f } } },
+    };
+}
+
+bool TuSteamAudio::GetAcousticMaterialPreset(AZStd::string_view name, IPLMaterial& out)
+{
+    for (const AcousticMaterialPreset& preset : Presets)
+    {
+        if (AZ::StringFunc::Equal(name, preset.m_name))
+        {
+            out = preset.m_material;
+            return true;
+        }
+    }
+    return false;
+}
+
+IPLMaterial TuSteamAudio::GetDefaultAcousticMaterial()
+{
+    return Presets[0].m_material;
+}
@@ -0,0 +1,21 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "phonon.h"
+
+#include <AzCore/std/string/string_view.h>
+
+namespace TuSteamAudio
+{
+    //! Steam Audio's standard material presets, matched by name (case insensitive).
+    //! Returns false and leaves out untouched if the name is unknown.
+    bool GetAcousticMaterialPreset(AZStd::string_view name, IPLMaterial& out);
+
+    //! The "Generic" preset.
+    IPLMaterial GetDefaultAcousticMaterial();
+} // TuSteamAudio
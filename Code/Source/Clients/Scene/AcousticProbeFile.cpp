@@ -0,0 +1,143 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "AcousticProbeFile.h"
+
+using namespace TuSteamAudio;
+
+bool AcousticProbeFile::Serialize(IPLContext context, const AZStd::vector<IPLProbeBatch>& probeBatches, const AZStd::vector<Region>& regions,
+    const Header& probeInfo, AZStd::vector<AZ::u8>& out)
+{
+    AZ_Assert(probeBatches.size() == regions.size(), "Every region needs a probe batch");
+
+    Header header = probeInfo;
+    header.m_magic = Header::Magic;
+    header.m_version = Header::CurrentVersion;
+    header.m_steamAudioVersion = STEAMAUDIO_VERSION;
+    header.m_regionCount = static_cast<AZ::u32>(regions.size());
+
+    AZStd::vector<Region> table = regions;
+    out.resize(GetTableSize(header));
+
+    for (size_t i = 0; i < probeBatches.size(); ++i)
+    {
+        IPLSerializedObjectSettings objectSettings{};
+        IPLSerializedObject object = nullptr;
+        IPLerror err = iplSerializedObjectCreate(context, &objectSettings, &object);
+        if (err != IPL_STATUS_SUCCESS)
+        {
+            AZ_Error("AcousticProbeFile", false, "Failed to create serialized object");
+            return false;
+        }
+
+        iplProbeBatchSave(probeBatches[i], object);
+
+        const IPLsize payloadSize = iplSerializedObjectGetSize(object);
+        const IPLbyte* payload = iplSerializedObjectGetData(object);
+
+        table[i].m_offset = out.size();
+        table[i].m_size = payloadSize;
+        table[i].m_contentHash = AcousticSceneFile::HashPayload(payload, payloadSize);
+        out.insert(out.end(), payload, payload + payloadSize);
+
+        iplSerializedObjectRelease(&object);
+    }
+
+    header.m_tableHash = AcousticSceneFile::HashPayload(table.data(), table.size() * sizeof(Region));
+    memcpy(out.data(), &header, sizeof(Header));
+    memcpy(out.data() + sizeof(Header), table.data(), table.size() * sizeof(Region));
+    return true;
+}
+
+size_t AcousticProbeFile::GetTableSize(const Header& header)
+{
+    return sizeof(Header) + static_cast<size_t>(header.m_regionCount) * sizeof(Region);
+}
+
+bool AcousticProbeFile::ReadTable(const void* data, size_t size, size_t fileSize, Header& outHeader, AZStd::vector<Region>& outRegions)
+{
+    if (!data || size < sizeof(Header))
+    {
+        return false;
+    }
+
+    Header header;
+    memcpy(&header, data, sizeof(Header));
+
+    if (header.m_magic != Header::Magic || header.m_version != Header::CurrentVersion)
+    {
+        AZ_Warning("AcousticProbeFile", false, "Not a reflection probe file, or an unsupported version");
+        return false;
+    }
+
+    if (header.m_steamAudioVersion != STEAMAUDIO_VERSION)
+    {
+        AZ_Warning("AcousticProbeFile", false, "Reflection probes were baked with a different Steam Audio version");
+        return false;
+    }
+
+    const size_t tableSize = GetTableSize(header);
+    if (size < tableSize)
+    {
+        outHeader = header;
+        return false;
+    }
+
+    AZStd::vector<Region> regions(header.m_regionCount);
+    memcpy(regions.data(), static_cast<const AZ::u8*>(data) + sizeof(Header), regions.size() * sizeof(Region));
+    if (AcousticSceneFile::HashPayload(regions.data(), regions.size() * sizeof(Region)) != header.m_tableHash)
+    {
+        AZ_Warning("AcousticProbeFile", false, "Reflection probe region table is corrupt");
+        return false;
+    }
+
+    for (const Region& region : regions)
+    {
+        if (region.m_offset < tableSize || region.m_offset + region.m_size > fileSize)
+        {
+            AZ_Warning("AcousticProbeFile", false, "Reflection probe file is truncated");
+            return false;
+        }
+    }
+
+    outHeader = header;
+    outRegions = AZStd::move(regions);
+    return true;
+}
+
+IPLProbeBatch AcousticProbeFile::LoadRegion(IPLContext context, const Region& region, const void* payload)
+{
+    if (AcousticSceneFile::HashPayload(payload, region.m_size) != region.m_contentHash)
+    {
+        AZ_Warning("AcousticProbeFile", false, "Reflection probe region is corrupt");
+        return nullptr;
+    }
+
+    IPLSerializedObjectSettings objectSettings{};
+    objectSettings.data = const_cast<IPLbyte*>(static_cast<const IPLbyte*>(payload));
+    objectSettings.size = region.m_size;
+
+    IPLSerializedObject object = nullptr;
+    IPLerror err = iplSerializedObjectCreate(context, &objectSettings, &object);
+    if (err != IPL_STATUS_SUCCESS)
+    {
+        AZ_Error("AcousticProbeFile", false, "Failed to create serialized object");
+        return nullptr;
+    }
+
+    IPLProbeBatch probeBatch = nullptr;
+    err = iplProbeBatchLoad(context, object, &probeBatch);
+    iplSerializedObjectRelease(&object);
+
+    if (err != IPL_STATUS_SUCCESS)
+    {
+        AZ_Error("AcousticProbeFile", false, "Failed to load reflection probes");
+        return nullptr;
+    }
+
+    iplProbeBatchCommit(probeBatch);
+    return probeBatch;
+}
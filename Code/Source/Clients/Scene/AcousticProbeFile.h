@@ -0,0 +1,68 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "AcousticSceneFile.h"
+
+namespace TuSteamAudio
+{
+    namespace AcousticProbeFile
+    {
+        //! Baked by the asset processor from a .saacoustic source, loaded next to the level's spawnable.
+        static constexpr const char* ProductExtension = "saprobes";
+
+        //! Listener centric reverb, the only data baked into the probes.
+        static constexpr IPLBakedDataIdentifier BakedReverb = { IPL_BAKEDDATATYPE_REFLECTIONS, IPL_BAKEDDATAVARIATION_REVERB };
+
+        //! Followed by m_regionCount Regions, then one iplProbeBatchSave payload per region.
+        struct Header
+        {
+            static constexpr AZ::u32 Magic = 0x53415350; // "PSAS"
+            static constexpr AZ::u32 CurrentVersion = 2;
+
+            AZ::u32 m_magic = Magic;
+            AZ::u32 m_version = CurrentVersion;
+            AZ::u32 m_steamAudioVersion = STEAMAUDIO_VERSION;
+            AZ::u32 m_probeCount = 0;
+            //! Ambisonic order and IR length the reverb was baked at, the simulator must allow at least as much.
+            AZ::u32 m_order = 0;
+            float m_duration = 0.0f;
+            AZ::u32 m_regionCount = 0;
+            //! Edge length of the square grid cells regions were cut from.
+            float m_regionSize = 0.0f;
+            //! Sha1 of the region table, each region carries the hash of its own payload.
+            AcousticSceneFile::ContentHash m_tableHash = {};
+        };
+
+        //! One streamable probe batch.
+        struct Region
+        {
+            //! Simulation space box the probes were generated in.
+            IPLVector3 m_boundsMin = {};
+            IPLVector3 m_boundsMax = {};
+            AZ::u32 m_probeCount = 0;
+            AZ::u32 m_padding = 0;
+            //! Payload location from the start of the file.
+            AZ::u64 m_offset = 0;
+            AZ::u64 m_size = 0;
+            AcousticSceneFile::ContentHash m_contentHash = {};
+        };
+
+        //! One committed, baked batch per region. Bounds and probe counts are taken from regions,
+        //! probe count, order, duration and region size from header.
+        bool Serialize(IPLContext context, const AZStd::vector<IPLProbeBatch>& probeBatches, const AZStd::vector<Region>& regions,
+            const Header& header, AZStd::vector<AZ::u8>& out);
+
+        //! Checks the header and region table at the start of a fileSize byte file, data holds at least size bytes of it.
+        //! Returns false without a warning when size is too small to hold the table, GetTableSize tells how much is needed.
+        bool ReadTable(const void* data, size_t size, size_t fileSize, Header& outHeader, AZStd::vector<Region>& outRegions);
+        size_t GetTableSize(const Header& header);
+
+        //! Deserializes one region's payload into a committed probe batch after checking its hash, null on failure.
+        IPLProbeBatch LoadRegion(IPLContext context, const Region& region, const void* payload);
+    } // AcousticProbeFile
+} // TuSteamAudio
@@ -0,0 +1,538 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "AcousticSceneBuilder.h"
+#include "AcousticMaterials.h"
+#include "AcousticSceneFile.h"
+#include "MappedFile.h"
+
+#include "Clients/Simulation/SimulationManager.h"
+
+#include <Atom/RPI.Reflect/Model/ModelAsset.h>
+#include <Atom/RPI.Reflect/Model/ModelLodAsset.h>
+#include <AzCore/Component/NonUniformScaleBus.h>
+#include <AzCore/Component/TransformBus.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/function/function_template.h>
+#include <AzFramework/Physics/ColliderComponentBus.h>
+#include <AzFramework/Physics/Shape.h>
+#include <TuSteamAudio/Allocators.h>
+#include <TuSteamAudio/TuSteamAudioBus.h>
+#include <Sune/Utils.h>
+
+using namespace TuSteamAudio;
+
+namespace
+{
+    // Simulation runs in the same space as the LabSound listener
+    IPLVector3 ToSimulationSpace(const AZ::Vector3& v)
+    {
+        const auto p = Sune::ToLab(v);
+        return IPLVector3{ p.x, p.y, p.z };
+    }
+
+    // A mirroring conversion flips triangle winding, and with it the normals Steam Audio reflects off
+    bool ConversionFlipsWinding()
+    {
+        const IPLVector3 x = ToSimulationSpace(AZ::Vector3::CreateAxisX());
+        const IPLVector3 y = ToSimulationSpace(AZ::Vector3::CreateAxisY());
+        const IPLVector3 z = ToSimulationSpace(AZ::Vector3::CreateAxisZ());
+        const float determinant = x.x * (y.y * z.z - y.z * z.y) - x.y * (y.x * z.z - y.z * z.x) + x.z * (y.x * z.y - y.y * z.x);
+        return determinant < 0.0f;
+    }
+
+    AZ::u32 ReadIndex(AZStd::span<const uint8_t> data, const AZ::RHI::BufferViewDescriptor& desc, AZ::u32 index)
+    {
+        const uint8_t* element = data.data() + (desc.m_elementOffset + index) * desc.m_elementSize;
+        if (desc.m_elementSize == sizeof(AZ::u16))
+        {
+            return *reinterpret_cast<const AZ::u16*>(element);
+        }
+        return *reinterpret_cast<const AZ::u32*>(element);
+    }
+}
+
+AcousticSceneSettings TuSteamAudio::ReadAcousticSceneSettings()
+{
+    AcousticSceneSettings settings;
+    auto* registry = AZ::SettingsRegistry::Get();
+    if (!registry)
+    {
+        return settings;
+    }
+
+    const AZStd::string path = "/TuSteamAudio/Scene";
+    AZStd::string geometrySource;
+
+    registry->Get(settings.m_enabled, path + "/Enabled");
+    if (registry->Get(geometrySource, path + "/GeometrySource"))
+    {
+        settings.m_geometrySource = geometrySource == "PhysicsCollider" ?
+            AcousticGeometrySource::PhysicsCollider : AcousticGeometrySource::RenderMesh;
+    }
+    registry->Get(settings.m_defaultMaterial, path + "/DefaultMaterial");
+    registry->Get(settings.m_useBakedScene, path + "/UseBakedScene");
+    return settings;
+}
+
+void AcousticSceneBuilder::Activate(IPLContext context, IPLScene scene, SimulationManager* simulation, const AcousticSceneSettings& settings)
+{
+    m_context = iplContextRetain(context);
+    m_scene = iplSceneRetain(scene);
+    m_simulation = simulation;
+    m_settings = settings;
+
+    m_defaultMaterial = GetDefaultAcousticMaterial();
+    if (!GetAcousticMaterialPreset(m_settings.m_defaultMaterial, m_defaultMaterial))
+    {
+        AZ_Warning("AcousticSceneBuilder", false, "Unknown acoustic material preset '%s', using Generic", m_settings.m_defaultMaterial.c_str());
+    }
+
+    if (!m_settings.m_enabled)
+    {
+        return;
+    }
+
+    AzFramework::RootSpawnableNotificationBus::Handler::BusConnect();
+
+    // Covers a level that was already loaded before we activated
+    Rebuild();
+}
+
+void AcousticSceneBuilder::Deactivate()
+{
+    AzFramework::RootSpawnableNotificationBus::Handler::BusDisconnect();
+    Clear();
+
+    if (m_scene)
+    {
+        iplSceneRelease(&m_scene);
+        m_scene = nullptr;
+    }
+
+    if (m_context)
+    {
+        iplContextRelease(&m_context);
+        m_context = nullptr;
+    }
+    m_simulation = nullptr;
+}
+
+void AcousticSceneBuilder::Rebuild()
+{
+    AZ_PROFILE_FUNCTION(Audio);
+    Clear();
+
+    if (!m_settings.m_enabled || !m_scene)
+    {
+        return;
+    }
+
+    if (m_settings.m_geometrySource == AcousticGeometrySource::RenderMesh)
+    {
+        GatherRenderMeshes();
+        FlushPending();
+    }
+    else
+    {
+        AZStd::vector<MeshInput> inputs;
+        GatherColliders(inputs);
+        Build(inputs);
+    }
+}
+
+void AcousticSceneBuilder::Clear()
+{
+    AZ::Render::MeshComponentNotificationBus::MultiHandler::BusDisconnect();
+    m_pendingRenderMeshes.clear();
+    m_bounds = AZ::Aabb::CreateNull();
+
+    if (m_bakedScene)
+    {
+        // Back to the root scene, the simulator keeps its own reference until then
+        if (m_simulation)
+        {
+            m_simulation->RequestSceneCommit(m_scene);
+        }
+        iplSceneRelease(&m_bakedScene);
+        m_bakedScene = nullptr;
+    }
+
+    if (m_staticMeshes.empty())
+    {
+        return;
+    }
+
+    for (auto& [entityId, staticMesh] : m_staticMeshes)
+    {
+        iplStaticMeshRemove(staticMesh, m_scene);
+        iplStaticMeshRelease(&staticMesh);
+    }
+    m_staticMeshes.clear();
+
+    if (m_simulation)
+    {
+        m_simulation->RequestSceneCommit(m_scene);
+    }
+}
+
+void AcousticSceneBuilder::FlushPending()
+{
+    if (m_pendingRenderMeshes.empty())
+    {
+        return;
+    }
+
+    AZStd::vector<MeshInput> inputs;
+    inputs.reserve(m_pendingRenderMeshes.size());
+    for (const AZ::EntityId& entityId : m_pendingRenderMeshes)
+    {
+        MeshInput input;
+        if (!FillCommon(entityId, input))
+        {
+            continue;
+        }
+
+        AZ::Render::MeshComponentRequestBus::EventResult(input.m_model, entityId, &AZ::Render::MeshComponentRequestBus::Events::GetModelAsset);
+        if (input.m_model.IsReady())
+        {
+            inputs.push_back(AZStd::move(input));
+        }
+    }
+    m_pendingRenderMeshes.clear();
+
+    Build(inputs);
+}
+
+void AcousticSceneBuilder::OnRootSpawnableReady(AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, [[maybe_unused]] uint32_t generation)
+{
+    Clear();
+
+    // The exported scene sits next to the level's spawnable in the cache
+    if (m_settings.m_useBakedScene && !rootSpawnable.GetHint().empty())
+    {
+        AZ::IO::Path bakedPath = AZ::IO::Path("@products@") / rootSpawnable.GetHint();
+        bakedPath.ReplaceExtension(AcousticSceneFile::ProductExtension);
+        if (LoadBakedScene(bakedPath.c_str()))
+        {
+            return;
+        }
+    }
+
+    Rebuild();
+}
+
+bool AcousticSceneBuilder::LoadBakedScene(const char* path)
+{
+    AZ_PROFILE_FUNCTION(Audio);
+    const PhononAllocationScope allocationScope(PhononAllocationCategory::Scene);
+
+    IPLScene scene = nullptr;
+    if (!ReadProduct(path, [this, &scene](const void* data, size_t size) { scene = AcousticSceneFile::Load(m_context, data, size); }))
+    {
+        return false;
+    }
+
+    if (!scene)
+    {
+        AZ_Warning("AcousticSceneBuilder", false, "Failed to load baked acoustic scene '%s', gathering level geometry instead", path);
+        return false;
+    }
+
+    Clear();
+    m_bakedScene = scene;
+    if (m_simulation)
+    {
+        m_simulation->RequestSceneCommit(m_bakedScene);
+    }
+    return true;
+}
+
+void AcousticSceneBuilder::OnRootSpawnableReleased([[maybe_unused]] uint32_t generation)
+{
+    Clear();
+}
+
+void AcousticSceneBuilder::OnModelReady([[maybe_unused]] const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset,
+    [[maybe_unused]] const AZ::Data::Instance<AZ::RPI::Model>& model)
+{
+    const AZ::EntityId* busId = AZ::Render::MeshComponentNotificationBus::GetCurrentBusId();
+    const AZ::EntityId entityId = busId ? *busId : m_connectingEntity;
+    if (entityId.IsValid())
+    {
+        m_pendingRenderMeshes.push_back(entityId);
+    }
+}
+
+void AcousticSceneBuilder::GatherRenderMeshes()
+{
+    AZStd::vector<AZ::EntityId> entities;
+    AZ::Render::MeshComponentRequestBus::EnumerateHandlers([&entities](AZ::Render::MeshComponentRequests*)
+    {
+        entities.push_back(*AZ::Render::MeshComponentRequestBus::GetCurrentBusId());
+        return true;
+    });
+
+    // Ready models report straight away through the connection policy, the rest once they load
+    for (const AZ::EntityId& entityId : entities)
+    {
+        bool isStatic = false;
+        AZ::TransformBus::EventResult(isStatic, entityId, &AZ::TransformBus::Events::IsStaticTransform);
+        if (isStatic)
+        {
+            m_connectingEntity = entityId;
+            AZ::Render::MeshComponentNotificationBus::MultiHandler::BusConnect(entityId);
+        }
+    }
+    m_connectingEntity.SetInvalid();
+}
+
+void AcousticSceneBuilder::GatherColliders(AZStd::vector<MeshInput>& inputs)
+{
+    // An entity can have several collider components, they become one static mesh
+    AZStd::unordered_map<AZ::EntityId, MeshInput> byEntity;
+    Physics::ColliderComponentRequestBus::EnumerateHandlers([this, &byEntity](Physics::ColliderComponentRequests* handler)
+    {
+        const AZ::EntityId entityId = *Physics::ColliderComponentRequestBus::GetCurrentBusId();
+
+        auto it = byEntity.find(entityId);
+        if (it == byEntity.end())
+        {
+            MeshInput input;
+            if (!FillCommon(entityId, input))
+            {
+                return true;
+            }
+            // Collider geometry already has the entity scale baked in
+            input.m_transform.SetUniformScale(1.0f);
+            input.m_nonUniformScale = AZ::Vector3::CreateOne();
+            it = byEntity.emplace(entityId, AZStd::move(input)).first;
+        }
+
+        MeshInput& input = it->second;
+        for (const AZStd::shared_ptr<Physics::Shape>& shape : handler->GetShapes())
+        {
+            AZStd::vector<AZ::Vector3> vertices;
+            AZStd::vector<AZ::u32> indices;
+            shape->GetGeometry(vertices, indices, nullptr);
+
+            const AZ::u32 base = static_cast<AZ::u32>(input.m_vertices.size());
+            input.m_vertices.insert(input.m_vertices.end(), vertices.begin(), vertices.end());
+            for (AZ::u32 index : indices)
+            {
+                input.m_indices.push_back(base + index);
+            }
+        }
+        return true;
+    });
+
+    inputs.reserve(byEntity.size());
+    for (auto& [entityId, input] : byEntity)
+    {
+        if (!input.m_indices.empty())
+        {
+            inputs.push_back(AZStd::move(input));
+        }
+    }
+}
+
+bool AcousticSceneBuilder::FillCommon(AZ::EntityId entityId, MeshInput& input) const
+{
+    // Moving geometry would need the scene rebuilt every frame
+    bool isStatic = false;
+    AZ::TransformBus::EventResult(isStatic, entityId, &AZ::TransformBus::Events::IsStaticTransform);
+    if (!isStatic)
+    {
+        return false;
+    }
+
+    input.m_entityId = entityId;
+    AZ::TransformBus::EventResult(input.m_transform, entityId, &AZ::TransformBus::Events::GetWorldTM);
+    AZ::NonUniformScaleRequestBus::EventResult(input.m_nonUniformScale, entityId, &AZ::NonUniformScaleRequestBus::Events::GetScale);
+
+    input.m_material = m_defaultMaterial;
+    AcousticMaterialRequestBus::EventResult(input.m_material, entityId, &AcousticMaterialRequestBus::Events::GetAcousticMaterial);
+    return true;
+}
+
+void AcousticSceneBuilder::ConvertRenderMesh(const MeshInput& input, ConvertedMesh& out)
+{
+    const auto& lods = input.m_model->GetLodAssets();
+    if (lods.empty() || !lods[0].IsReady())
+    {
+        return;
+    }
+
+    static const AZ::Name PositionSemantic("POSITION");
+    for (const AZ::RPI::ModelLodAsset::Mesh& mesh : lods[0]->GetMeshes())
+    {
+        const AZ::RPI::BufferAssetView* positionView = mesh.GetSemanticBufferAssetView(PositionSemantic);
+        if (!positionView || !positionView->GetBufferAsset().IsReady())
+        {
+            continue;
+        }
+
+        const AZ::RPI::BufferAssetView& indexView = mesh.GetIndexBufferAssetView();
+        if (!indexView.GetBufferAsset().IsReady())
+        {
+            continue;
+        }
+
+        const AZ::RHI::BufferViewDescriptor& positionDesc = positionView->GetBufferViewDescriptor();
+        const AZStd::span<const uint8_t> positionData = positionView->GetBufferAsset()->GetBuffer();
+        const AZ::u32 base = static_cast<AZ::u32>(out.m_vertices.size());
+
+        out.m_vertices.reserve(out.m_vertices.size() + positionDesc.m_elementCount);
+        for (AZ::u32 v = 0; v < positionDesc.m_elementCount; ++v)
+        {
+            const float* position = reinterpret_cast<const float*>(
+                positionData.data() + (positionDesc.m_elementOffset + v) * positionDesc.m_elementSize);
+            const AZ::Vector3 local = AZ::Vector3(position[0], position[1], position[2]) * input.m_nonUniformScale;
+            out.m_vertices.push_back(ToSimulationSpace(input.m_transform.TransformPoint(local)));
+        }
+
+        const AZ::RHI::BufferViewDescriptor& indexDesc = indexView.GetBufferViewDescriptor();
+        const AZStd::span<const uint8_t> indexData = indexView.GetBufferAsset()->GetBuffer();
+
+        out.m_triangles.reserve(out.m_triangles.size() + indexDesc.m_elementCount / 3);
+        for (AZ::u32 i = 0; i + 2 < indexDesc.m_elementCount; i += 3)
+        {
+            IPLTriangle triangle;
+            for (int corner = 0; corner < 3; ++corner)
+            {
+                triangle.indices[corner] = static_cast<IPLint32>(base + ReadIndex(indexData, indexDesc, i + corner));
+            }
+            out.m_triangles.push_back(triangle);
+        }
+    }
+}
+
+void AcousticSceneBuilder::ConvertCollider(const MeshInput& input, ConvertedMesh& out)
+{
+    out.m_vertices.reserve(input.m_vertices.size());
+    for (const AZ::Vector3& local : input.m_vertices)
+    {
+        out.m_vertices.push_back(ToSimulationSpace(input.m_transform.TransformPoint(local)));
+    }
+
+    out.m_triangles.reserve(input.m_indices.size() / 3);
+    for (size_t i = 0; i + 2 < input.m_indices.size(); i += 3)
+    {
+        IPLTriangle triangle;
+        for (int corner = 0; corner < 3; ++corner)
+        {
+            triangle.indices[corner] = static_cast<IPLint32>(input.m_indices[i + corner]);
+        }
+        out.m_triangles.push_back(triangle);
+    }
+}
+
+void AcousticSceneBuilder::Build(const AZStd::vector<MeshInput>& inputs)
+{
+    AZ_PROFILE_FUNCTION(Audio);
+    const PhononAllocationScope allocationScope(PhononAllocationCategory::Scene);
+    if (inputs.empty())
+    {
+        return;
+    }
+
+    const bool flipWinding = ConversionFlipsWinding();
+    AZStd::vector<ConvertedMesh> converted(inputs.size());
+
+    // Vertex transforms and index expansion are the bulk of the work, one job per mesh
+    AZ::JobCompletion completion;
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        AZ::Job* job = AZ::CreateJobFunction([&inputs, &converted, i, flipWinding]()
+        {
+            if (inputs[i].m_model.IsReady())
+            {
+                ConvertRenderMesh(inputs[i], converted[i]);
+            }
+            else
+            {
+                ConvertCollider(inputs[i], converted[i]);
+            }
+
+            if (flipWinding)
+            {
+                for (IPLTriangle& triangle : converted[i].m_triangles)
+                {
+                    AZStd::swap(triangle.indices[1], triangle.indices[2]);
+                }
+            }
+        }, true);
+        job->SetDependent(&completion);
+        job->Start();
+    }
+    completion.StartAndWaitForCompletion();
+
+    // Steam Audio objects are created serially, the scene isn't safe to modify from several threads
+    size_t added = 0;
+    for (size_t i = 0; i < inputs.size(); ++i)
+    {
+        ConvertedMesh& mesh = converted[i];
+        if (mesh.m_triangles.empty())
+        {
+            continue;
+        }
+
+        RemoveStaticMesh(inputs[i].m_entityId);
+
+        AZStd::vector<IPLint32> materialIndices(mesh.m_triangles.size(), 0);
+        IPLMaterial material = inputs[i].m_material;
+
+        IPLStaticMeshSettings meshSettings{};
+        meshSettings.numVertices = static_cast<IPLint32>(mesh.m_vertices.size());
+        meshSettings.numTriangles = static_cast<IPLint32>(mesh.m_triangles.size());
+        meshSettings.numMaterials = 1;
+        meshSettings.vertices = mesh.m_vertices.data();
+        meshSettings.triangles = mesh.m_triangles.data();
+        meshSettings.materialIndices = materialIndices.data();
+        meshSettings.materials = &material;
+
+        IPLStaticMesh staticMesh = nullptr;
+        IPLerror err = iplStaticMeshCreate(m_scene, &meshSettings, &staticMesh);
+        if (err != IPL_STATUS_SUCCESS)
+        {
+            AZ_Error("AcousticSceneBuilder", false, "Failed to create static mesh for entity %s", inputs[i].m_entityId.ToString().c_str());
+            continue;
+        }
+
+        iplStaticMeshAdd(staticMesh, m_scene);
+        m_staticMeshes[inputs[i].m_entityId] = staticMesh;
+        ++added;
+
+        for (const IPLVector3& vertex : mesh.m_vertices)
+        {
+            m_bounds.AddPoint(AZ::Vector3(vertex.x, vertex.y, vertex.z));
+        }
+    }
+
+    if (added > 0 && m_simulation)
+    {
+        m_simulation->RequestSceneCommit(m_scene);
+    }
+}
+
+void AcousticSceneBuilder::RemoveStaticMesh(AZ::EntityId entityId)
+{
+    auto it = m_staticMeshes.find(entityId);
+    if (it == m_staticMeshes.end())
+    {
+        return;
+    }
+
+    iplStaticMeshRemove(it->second, m_scene);
+    iplStaticMeshRelease(&it->second);
+    m_staticMeshes.erase(it);
+}
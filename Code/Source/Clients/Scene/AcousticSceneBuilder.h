@@ -0,0 +1,124 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "phonon.h"
+
+#include <AtomLyIntegration/CommonFeatures/Mesh/MeshComponentBus.h>
+#include <AzCore/Component/EntityId.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Spawnable/RootSpawnableInterface.h>
+
+namespace TuSteamAudio
+{
+    class SimulationManager;
+
+    //! Where the acoustic geometry is taken from.
+    enum class AcousticGeometrySource
+    {
+        RenderMesh,
+        PhysicsCollider
+    };
+
+    struct AcousticSceneSettings
+    {
+        bool m_enabled = true;
+        AcousticGeometrySource m_geometrySource = AcousticGeometrySource::RenderMesh;
+        //! Preset used for entities that don't answer AcousticMaterialRequestBus.
+        AZStd::string m_defaultMaterial = "Generic";
+        //! Load the level's exported .saacousticscene when there is one instead of gathering geometry.
+        bool m_useBakedScene = true;
+    };
+
+    //! Reads /TuSteamAudio/Scene from the settings registry, shared by the runtime and the editor exporter.
+    AcousticSceneSettings ReadAcousticSceneSettings();
+
+    //! Fills the root IPLScene with one IPLStaticMesh per static entity of the loaded level.
+    //! Geometry is gathered on the main thread, converted to world space triangles in parallel jobs,
+    //! then handed to Steam Audio and committed through the SimulationManager.
+    //! A level with an exported acoustic scene skips all of that and simulates the loaded scene instead.
+    class AcousticSceneBuilder
+        : protected AzFramework::RootSpawnableNotificationBus::Handler
+        , protected AZ::Render::MeshComponentNotificationBus::MultiHandler
+    {
+    public:
+        void Activate(IPLContext context, IPLScene scene, SimulationManager* simulation, const AcousticSceneSettings& settings);
+        void Deactivate();
+
+        //! Drops every static mesh and gathers the level again.
+        void Rebuild();
+        void Clear();
+        //! Main thread, converts meshes whose models finished loading since the last call.
+        void FlushPending();
+
+        size_t GetStaticMeshCount() const { return m_staticMeshes.size(); }
+        //! Simulation space box around every mesh added since the last Clear. Never shrinks on a mesh replacement.
+        const AZ::Aabb& GetBounds() const { return m_bounds; }
+        bool IsUsingBakedScene() const { return m_bakedScene != nullptr; }
+
+        //! Loads an exported scene, memory mapped when it is a loose file. Any alias path works.
+        bool LoadBakedScene(const char* path);
+
+    protected:
+        // RootSpawnableNotificationBus
+        void OnRootSpawnableReady(AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, uint32_t generation) override;
+        void OnRootSpawnableReleased(uint32_t generation) override;
+
+        // MeshComponentNotificationBus, models that were still loading during the last gather
+        void OnModelReady(const AZ::Data::Asset<AZ::RPI::ModelAsset>& modelAsset, const AZ::Data::Instance<AZ::RPI::Model>& model) override;
+
+    private:
+        //! Everything a job needs, captured on the main thread.
+        struct MeshInput
+        {
+            AZ::EntityId m_entityId;
+            AZ::Transform m_transform = AZ::Transform::Identity();
+            AZ::Vector3 m_nonUniformScale = AZ::Vector3::CreateOne();
+            IPLMaterial m_material = {};
+            //Render mesh path, read inside the job
+            AZ::Data::Asset<AZ::RPI::ModelAsset> m_model;
+            //Collider path, already in the entity's local space
+            AZStd::vector<AZ::Vector3> m_vertices;
+            AZStd::vector<AZ::u32> m_indices;
+        };
+
+        struct ConvertedMesh
+        {
+            AZStd::vector<IPLVector3> m_vertices;
+            AZStd::vector<IPLTriangle> m_triangles;
+        };
+
+        void GatherRenderMeshes();
+        void GatherColliders(AZStd::vector<MeshInput>& inputs);
+        bool FillCommon(AZ::EntityId entityId, MeshInput& input) const;
+
+        static void ConvertRenderMesh(const MeshInput& input, ConvertedMesh& out);
+        static void ConvertCollider(const MeshInput& input, ConvertedMesh& out);
+
+        //! Converts every input in parallel, then adds the results to the scene and requests a commit.
+        void Build(const AZStd::vector<MeshInput>& inputs);
+        void RemoveStaticMesh(AZ::EntityId entityId);
+
+        IPLContext m_context = nullptr;
+        IPLScene m_scene = nullptr;
+        SimulationManager* m_simulation = nullptr;
+        AcousticSceneSettings m_settings;
+        IPLMaterial m_defaultMaterial = {};
+
+        AZStd::unordered_map<AZ::EntityId, IPLStaticMesh> m_staticMeshes;
+        AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+        //Replaces m_scene in the simulator while a baked level is loaded
+        IPLScene m_bakedScene = nullptr;
+        AZStd::vector<AZ::EntityId> m_pendingRenderMeshes;
+        //Connecting a MultiHandler can report OnModelReady before any bus id is current
+        AZ::EntityId m_connectingEntity;
+    };
+} // TuSteamAudio
@@ -0,0 +1,153 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "AcousticSceneFile.h"
+
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace TuSteamAudio;
+
+AcousticSceneFile::ContentHash AcousticSceneFile::HashPayload(const void* data, size_t size)
+{
+    AZ::Sha1 sha;
+    sha.ProcessBytes(data, size);
+
+    AZ::u32 digest[5];
+    sha.GetDigest(digest);
+
+    ContentHash hash;
+    AZStd::copy(digest, digest + 5, hash.begin());
+    return hash;
+}
+
+bool AcousticSceneFile::Serialize(IPLContext context, IPLScene scene, const Header& sceneInfo, AZStd::vector<AZ::u8>& out)
+{
+    IPLSerializedObjectSettings objectSettings{};
+    IPLSerializedObject object = nullptr;
+    IPLerror err = iplSerializedObjectCreate(context, &objectSettings, &object);
+    if (err != IPL_STATUS_SUCCESS)
+    {
+        AZ_Error("AcousticSceneFile", false, "Failed to create serialized object");
+        return false;
+    }
+
+    iplSceneSave(scene, object);
+
+    const IPLsize payloadSize = iplSerializedObjectGetSize(object);
+    const IPLbyte* payload = iplSerializedObjectGetData(object);
+
+    Header header = sceneInfo;
+    header.m_magic = Header::Magic;
+    header.m_version = Header::CurrentVersion;
+    header.m_steamAudioVersion = STEAMAUDIO_VERSION;
+    header.m_payloadSize = payloadSize;
+    header.m_contentHash = HashPayload(payload, payloadSize);
+
+    out.resize(sizeof(Header) + payloadSize);
+    memcpy(out.data(), &header, sizeof(Header));
+    memcpy(out.data() + sizeof(Header), payload, payloadSize);
+
+    iplSerializedObjectRelease(&object);
+    return true;
+}
+
+bool AcousticSceneFile::Validate(const void* data, size_t size, Header* outHeader)
+{
+    if (!data || size < sizeof(Header))
+    {
+        return false;
+    }
+
+    Header header;
+    memcpy(&header, data, sizeof(Header));
+
+    if (header.m_magic != Header::Magic || header.m_version != Header::CurrentVersion)
+    {
+        AZ_Warning("AcousticSceneFile", false, "Not an acoustic scene file, or an unsupported version");
+        return false;
+    }
+
+    if (header.m_steamAudioVersion != STEAMAUDIO_VERSION)
+    {
+        AZ_Warning("AcousticSceneFile", false, "Acoustic scene was exported with a different Steam Audio version, export it again");
+        return false;
+    }
+
+    if (header.m_payloadSize != size - sizeof(Header))
+    {
+        AZ_Warning("AcousticSceneFile", false, "Acoustic scene file is truncated");
+        return false;
+    }
+
+    const AZ::u8* payload = static_cast<const AZ::u8*>(data) + sizeof(Header);
+    if (HashPayload(payload, header.m_payloadSize) != header.m_contentHash)
+    {
+        AZ_Warning("AcousticSceneFile", false, "Acoustic scene file is corrupt");
+        return false;
+    }
+
+    if (outHeader)
+    {
+        *outHeader = header;
+    }
+    return true;
+}
+
+bool AcousticSceneFile::ReadHeader(const char* path, Header& outHeader)
+{
+    AZ::IO::SystemFile file;
+    if (!file.Open(path, AZ::IO::SystemFile::SF_OPEN_READ_ONLY))
+    {
+        return false;
+    }
+
+    Header header;
+    if (file.Read(sizeof(Header), &header) != sizeof(Header) || header.m_magic != Header::Magic)
+    {
+        return false;
+    }
+
+    outHeader = header;
+    return true;
+}
+
+IPLScene AcousticSceneFile::Load(IPLContext context, const void* data, size_t size)
+{
+    Header header;
+    if (!Validate(data, size, &header))
+    {
+        return nullptr;
+    }
+
+    // The serialized object only wraps the buffer, iplSceneLoad copies what it needs
+    IPLSerializedObjectSettings objectSettings{};
+    objectSettings.data = const_cast<IPLbyte*>(static_cast<const IPLbyte*>(data) + sizeof(Header));
+    objectSettings.size = header.m_payloadSize;
+
+    IPLSerializedObject object = nullptr;
+    IPLerror err = iplSerializedObjectCreate(context, &objectSettings, &object);
+    if (err != IPL_STATUS_SUCCESS)
+    {
+        AZ_Error("AcousticSceneFile", false, "Failed to create serialized object");
+        return nullptr;
+    }
+
+    IPLSceneSettings sceneSettings{};
+    sceneSettings.type = IPL_SCENETYPE_DEFAULT;
+
+    IPLScene scene = nullptr;
+    err = iplSceneLoad(context, &sceneSettings, object, nullptr, nullptr, &scene);
+    iplSerializedObjectRelease(&object);
+
+    if (err != IPL_STATUS_SUCCESS)
+    {
+        AZ_Error("AcousticSceneFile", false, "Failed to load acoustic scene");
+        return nullptr;
+    }
+    return scene;
+}
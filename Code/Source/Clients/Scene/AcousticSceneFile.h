@@ -0,0 +1,59 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "phonon.h"
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace TuSteamAudio
+{
+    namespace AcousticSceneFile
+    {
+        //! Exported by the editor, picked up by the asset processor.
+        static constexpr const char* SourceExtension = "saacoustic";
+        //! Built product, loaded at runtime next to the level's spawnable.
+        static constexpr const char* ProductExtension = "saacousticscene";
+
+        using ContentHash = AZStd::array<AZ::u32, 5>;
+
+        //! Precedes the iplSceneSave payload in both the source and the product.
+        struct Header
+        {
+            static constexpr AZ::u32 Magic = 0x53415354; // "TSAS"
+            static constexpr AZ::u32 CurrentVersion = 2;
+
+            AZ::u32 m_magic = Magic;
+            AZ::u32 m_version = CurrentVersion;
+            AZ::u32 m_steamAudioVersion = STEAMAUDIO_VERSION;
+            AZ::u32 m_staticMeshCount = 0;
+            AZ::u64 m_payloadSize = 0;
+            //! Sha1 of the payload, identical geometry always hashes the same.
+            ContentHash m_contentHash = {};
+            //! Simulation space box around all geometry, the volume reflection probes are generated in.
+            IPLVector3 m_boundsMin = {};
+            IPLVector3 m_boundsMax = {};
+        };
+
+        ContentHash HashPayload(const void* data, size_t size);
+
+        //! Saves a committed scene with our header in front. Mesh count and bounds are taken from header,
+        //! the rest is filled in.
+        bool Serialize(IPLContext context, IPLScene scene, const Header& header, AZStd::vector<AZ::u8>& out);
+
+        //! Checks magic, versions, size and hash. Returns the header through outHeader when valid.
+        bool Validate(const void* data, size_t size, Header* outHeader = nullptr);
+
+        //! Reads only the header of a file on disk, for duplicate checks.
+        bool ReadHeader(const char* path, Header& outHeader);
+
+        //! Deserializes a validated buffer into a new scene, null on failure. The buffer is not referenced afterwards.
+        IPLScene Load(IPLContext context, const void* data, size_t size);
+    } // AcousticSceneFile
+} // TuSteamAudio
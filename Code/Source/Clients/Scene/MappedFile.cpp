@@ -0,0 +1,52 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "MappedFile.h"
+
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/containers/vector.h>
+
+using namespace TuSteamAudio;
+
+bool TuSteamAudio::ReadProduct(const char* path, const AZStd::function<void(const void*, size_t)>& use)
+{
+    auto* fileIO = AZ::IO::FileIOBase::GetInstance();
+    if (!fileIO || !fileIO->Exists(path))
+    {
+        return false;
+    }
+
+    char resolvedPath[AZ_MAX_PATH_LEN] = {};
+    MappedFile mapped;
+    if (fileIO->ResolvePath(path, resolvedPath, sizeof(resolvedPath)) && mapped.Open(resolvedPath))
+    {
+        use(mapped.GetData(), mapped.GetSize());
+        return true;
+    }
+
+    // Packed in an archive, nothing to map
+    AZ::IO::HandleType handle = AZ::IO::InvalidHandle;
+    if (!fileIO->Open(path, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, handle))
+    {
+        return false;
+    }
+
+    bool read = false;
+    AZ::u64 size = 0;
+    AZStd::vector<AZ::u8> buffer;
+    if (fileIO->Size(handle, size) && size > 0)
+    {
+        buffer.resize_no_construct(size);
+        read = fileIO->Read(handle, buffer.data(), size, true);
+    }
+    fileIO->Close(handle);
+
+    if (read)
+    {
+        use(buffer.data(), buffer.size());
+    }
+    return read;
+}
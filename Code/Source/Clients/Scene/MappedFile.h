@@ -0,0 +1,40 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/function/function_template.h>
+
+namespace TuSteamAudio
+{
+    //! Read only memory mapping of a whole file, implemented per platform.
+    //! Only works on loose files, callers fall back to reading the file when Open fails.
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool Open(const char* path);
+        void Close();
+
+        bool IsOpen() const { return m_data != nullptr; }
+        const AZ::u8* GetData() const { return m_data; }
+        size_t GetSize() const { return m_size; }
+
+    private:
+        const AZ::u8* m_data = nullptr;
+        size_t m_size = 0;
+        //Platform mapping handle, unused where the mapping outlives its handle
+        void* m_mapping = nullptr;
+    };
+
+    //! Hands a product's bytes to use, memory mapped when it is a loose file. Returns false if it can't be read.
+    bool ReadProduct(const char* path, const AZStd::function<void(const void*, size_t)>& use);
+} // TuSteamAudio
@@ -0,0 +1,378 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "ProbeStreamer.h"
+
+#include "Clients/Simulation/SimulationManager.h"
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/sort.h>
+#include <TuSteamAudio/Allocators.h>
+#include <TuSteamAudio/TuSteamAudioBus.h>
+
+#include <cmath>
+
+using namespace TuSteamAudio;
+
+namespace
+{
+    // Loaded regions stay until the listener is this much farther than the load radius, so walking along
+    // a region border doesn't load and evict it every few frames
+    constexpr float UnloadHysteresis = 1.25f;
+
+    float DistanceToRegion(const AcousticProbeFile::Region& region, const IPLVector3& point)
+    {
+        const float dx = AZStd::max(AZStd::max(region.m_boundsMin.x - point.x, 0.0f), point.x - region.m_boundsMax.x);
+        const float dy = AZStd::max(AZStd::max(region.m_boundsMin.y - point.y, 0.0f), point.y - region.m_boundsMax.y);
+        const float dz = AZStd::max(AZStd::max(region.m_boundsMin.z - point.z, 0.0f), point.z - region.m_boundsMax.z);
+        return std::sqrt(dx * dx + dy * dy + dz * dz);
+    }
+
+    bool ReadRange(const char* path, AZ::u64 offset, AZ::u64 size, AZStd::vector<AZ::u8>& out)
+    {
+        auto* fileIO = AZ::IO::FileIOBase::GetInstance();
+        AZ::IO::HandleType handle = AZ::IO::InvalidHandle;
+        if (!fileIO || !fileIO->Open(path, AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary, handle))
+        {
+            return false;
+        }
+
+        out.resize_no_construct(size);
+        const bool read = fileIO->Seek(handle, static_cast<AZ::s64>(offset), AZ::IO::SeekType::SeekFromStart) &&
+            fileIO->Read(handle, out.data(), size, true);
+        fileIO->Close(handle);
+        return read;
+    }
+}
+
+ProbeStreamingSettings TuSteamAudio::ReadProbeStreamingSettings()
+{
+    ProbeStreamingSettings settings;
+    auto* registry = AZ::SettingsRegistry::Get();
+    if (!registry)
+    {
+        return settings;
+    }
+
+    const AZStd::string path = "/TuSteamAudio/Probes";
+    AZ::s64 value = 0;
+    double number = 0.0;
+
+    registry->Get(settings.m_enabled, path + "/Enabled");
+    if (registry->Get(number, path + "/StreamingRadius"))
+    {
+        settings.m_radius = static_cast<float>(number);
+    }
+    if (registry->Get(value, path + "/MemoryBudgetMB"))
+    {
+        settings.m_memoryBudget = static_cast<AZ::u64>(AZStd::max<AZ::s64>(value, 0)) * 1024 * 1024;
+    }
+    if (registry->Get(value, path + "/MaxLoadsInFlight"))
+    {
+        settings.m_maxLoadsInFlight = AZStd::max(1, static_cast<int>(value));
+    }
+    return settings;
+}
+
+void ProbeStreamer::Activate(IPLContext context, SimulationManager* simulation, const ProbeStreamingSettings& settings)
+{
+    m_context = iplContextRetain(context);
+    m_simulation = simulation;
+    m_settings = settings;
+
+    if (m_settings.m_enabled)
+    {
+        AzFramework::RootSpawnableNotificationBus::Handler::BusConnect();
+    }
+}
+
+void ProbeStreamer::Deactivate()
+{
+    AzFramework::RootSpawnableNotificationBus::Handler::BusDisconnect();
+    Close();
+
+    if (m_context)
+    {
+        iplContextRelease(&m_context);
+        m_context = nullptr;
+    }
+    m_simulation = nullptr;
+}
+
+void ProbeStreamer::OnRootSpawnableReady(AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, [[maybe_unused]] uint32_t generation)
+{
+    Close();
+
+    // Baked next to the level's spawnable, like the acoustic scene
+    if (!rootSpawnable.GetHint().empty())
+    {
+        AZ::IO::Path probesPath = AZ::IO::Path("@products@") / rootSpawnable.GetHint();
+        probesPath.ReplaceExtension(AcousticProbeFile::ProductExtension);
+        Open(probesPath.c_str());
+    }
+}
+
+void ProbeStreamer::OnRootSpawnableReleased([[maybe_unused]] uint32_t generation)
+{
+    Close();
+}
+
+bool ProbeStreamer::Open(const char* path)
+{
+    AZ_PROFILE_FUNCTION(Audio);
+    Close();
+
+    auto* fileIO = AZ::IO::FileIOBase::GetInstance();
+    if (!m_simulation || !fileIO || !fileIO->Exists(path))
+    {
+        return false;
+    }
+
+    auto source = AZStd::make_shared<StreamSource>();
+    source->m_path = path;
+
+    AcousticProbeFile::Header header;
+    AZStd::vector<AcousticProbeFile::Region> regions;
+    bool valid = false;
+
+    char resolvedPath[AZ_MAX_PATH_LEN] = {};
+    if (fileIO->ResolvePath(path, resolvedPath, sizeof(resolvedPath)) && source->m_mapped.Open(resolvedPath))
+    {
+        valid = AcousticProbeFile::ReadTable(source->m_mapped.GetData(), source->m_mapped.GetSize(), source->m_mapped.GetSize(), header, regions);
+    }
+    else
+    {
+        // Packed in an archive, read the header and then the table behind it
+        AZ::u64 fileSize = 0;
+        AZStd::vector<AZ::u8> table;
+        if (fileIO->Size(path, fileSize) && fileSize >= sizeof(header) && ReadRange(path, 0, sizeof(header), table))
+        {
+            memcpy(&header, table.data(), sizeof(header));
+            const size_t tableSize = AcousticProbeFile::GetTableSize(header);
+            valid = tableSize <= fileSize && ReadRange(path, 0, tableSize, table) &&
+                AcousticProbeFile::ReadTable(table.data(), table.size(), fileSize, header, regions);
+        }
+    }
+
+    if (!valid)
+    {
+        AZ_Warning("ProbeStreamer", false, "Failed to read baked reflection probes '%s', reflections are traced in real time", path);
+        return false;
+    }
+
+    // Baked IRs longer or of higher order than the simulator was created for can't be applied
+    const IPLSimulationSettings simulationSettings = TuSteamAudioInterface::Get()->GetSimulationSettings();
+    if (static_cast<int>(header.m_order) > simulationSettings.maxOrder || header.m_duration > simulationSettings.maxDuration)
+    {
+        AZ_Warning("ProbeStreamer", false, "Reflection probes in '%s' were baked at order %u and %.1fs, the simulator allows order %d and %.1fs. Bake them again.",
+            path, header.m_order, header.m_duration, simulationSettings.maxOrder, simulationSettings.maxDuration);
+        return false;
+    }
+
+    m_source = AZStd::move(source);
+    m_regions.resize(regions.size());
+    for (size_t i = 0; i < regions.size(); ++i)
+    {
+        m_regions[i].m_region = regions[i];
+    }
+
+    AZ_TracePrintf("ProbeStreamer", "%u reflection probes in %u regions of %.0fm from %s\n",
+        header.m_probeCount, header.m_regionCount, header.m_regionSize, path);
+    return true;
+}
+
+void ProbeStreamer::Close()
+{
+    if (m_source)
+    {
+        // Jobs still running release their batch instead of queueing it
+        AZStd::lock_guard<AZStd::mutex> lock(m_source->m_mutex);
+        m_source->m_closed = true;
+        for (auto& [regionIndex, probeBatch] : m_source->m_completed)
+        {
+            if (probeBatch)
+            {
+                iplProbeBatchRelease(&probeBatch);
+            }
+        }
+        m_source->m_completed.clear();
+    }
+    m_source = nullptr;
+
+    for (RegionState& state : m_regions)
+    {
+        Unload(state);
+    }
+    m_regions.clear();
+    m_residentBytes = 0;
+    m_loadsInFlight = 0;
+    m_warnedBudget = false;
+}
+
+void ProbeStreamer::Update(const IPLVector3& listenerPosition)
+{
+    if (m_regions.empty())
+    {
+        return;
+    }
+
+    AZ_PROFILE_FUNCTION(Audio);
+    CollectCompletedLoads();
+
+    AZStd::vector<size_t> wanted;
+    for (size_t i = 0; i < m_regions.size(); ++i)
+    {
+        RegionState& state = m_regions[i];
+        state.m_distance = DistanceToRegion(state.m_region, listenerPosition);
+
+        if (state.m_status == RegionStatus::Loaded && state.m_distance > m_settings.m_radius * UnloadHysteresis)
+        {
+            Unload(state);
+        }
+        else if (state.m_status == RegionStatus::Unloaded && state.m_distance <= m_settings.m_radius)
+        {
+            wanted.push_back(i);
+        }
+    }
+
+    // Nearest first, they matter most and are the last to be evicted for budget
+    AZStd::sort(wanted.begin(), wanted.end(), [this](size_t a, size_t b)
+    {
+        return m_regions[a].m_distance < m_regions[b].m_distance;
+    });
+
+    for (size_t regionIndex : wanted)
+    {
+        if (m_loadsInFlight >= m_settings.m_maxLoadsInFlight)
+        {
+            break;
+        }
+
+        const RegionState& state = m_regions[regionIndex];
+        if (!MakeRoom(state.m_region.m_size, state.m_distance))
+        {
+            AZ_Warning("ProbeStreamer", m_warnedBudget, "Reflection probe memory budget of %llu bytes reached, distant regions stay unloaded",
+                static_cast<unsigned long long>(m_settings.m_memoryBudget));
+            m_warnedBudget = true;
+            break;
+        }
+        StartLoad(regionIndex);
+    }
+}
+
+void ProbeStreamer::CollectCompletedLoads()
+{
+    AZStd::vector<AZStd::pair<size_t, IPLProbeBatch>> completed;
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_source->m_mutex);
+        completed.swap(m_source->m_completed);
+    }
+
+    for (auto& [regionIndex, probeBatch] : completed)
+    {
+        RegionState& state = m_regions[regionIndex];
+        --m_loadsInFlight;
+
+        if (!probeBatch)
+        {
+            // Corrupt regions would fail again, leave them out for the rest of the level
+            state.m_status = RegionStatus::Failed;
+            m_residentBytes -= state.m_region.m_size;
+            continue;
+        }
+
+        state.m_probeBatch = probeBatch;
+        state.m_status = RegionStatus::Loaded;
+        m_simulation->AddProbeBatch(probeBatch);
+    }
+}
+
+void ProbeStreamer::StartLoad(size_t regionIndex)
+{
+    RegionState& state = m_regions[regionIndex];
+    state.m_status = RegionStatus::Loading;
+    m_residentBytes += state.m_region.m_size;
+    ++m_loadsInFlight;
+
+    // The job keeps the source and context alive, Close may happen before it runs
+    AZ::Job* job = AZ::CreateJobFunction([source = m_source, context = iplContextRetain(m_context), region = state.m_region, regionIndex]() mutable
+    {
+        AZ_PROFILE_SCOPE(Audio, "ProbeStreamer::Load");
+        const PhononAllocationScope allocationScope(PhononAllocationCategory::Probes);
+
+        IPLProbeBatch probeBatch = nullptr;
+        if (source->m_mapped.IsOpen())
+        {
+            probeBatch = AcousticProbeFile::LoadRegion(context, region, source->m_mapped.GetData() + region.m_offset);
+        }
+        else
+        {
+            AZStd::vector<AZ::u8> payload;
+            if (ReadRange(source->m_path.c_str(), region.m_offset, region.m_size, payload))
+            {
+                probeBatch = AcousticProbeFile::LoadRegion(context, region, payload.data());
+            }
+        }
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(source->m_mutex);
+            if (!source->m_closed)
+            {
+                source->m_completed.emplace_back(regionIndex, probeBatch);
+                probeBatch = nullptr;
+            }
+        }
+
+        if (probeBatch)
+        {
+            iplProbeBatchRelease(&probeBatch);
+        }
+        iplContextRelease(&context);
+    }, true);
+    job->Start();
+}
+
+void ProbeStreamer::Unload(RegionState& state)
+{
+    if (state.m_status != RegionStatus::Loaded)
+    {
+        return;
+    }
+
+    // Queued with this frame's other changes, the simulator keeps its reference until then
+    m_simulation->RemoveProbeBatch(state.m_probeBatch);
+    iplProbeBatchRelease(&state.m_probeBatch);
+    state.m_probeBatch = nullptr;
+    state.m_status = RegionStatus::Unloaded;
+    m_residentBytes -= state.m_region.m_size;
+}
+
+bool ProbeStreamer::MakeRoom(AZ::u64 bytes, float distance)
+{
+    while (m_residentBytes + bytes > m_settings.m_memoryBudget)
+    {
+        RegionState* farthest = nullptr;
+        for (RegionState& state : m_regions)
+        {
+            if (state.m_status == RegionStatus::Loaded && state.m_distance > distance &&
+                (!farthest || state.m_distance > farthest->m_distance))
+            {
+                farthest = &state;
+            }
+        }
+
+        if (!farthest)
+        {
+            return false;
+        }
+        Unload(*farthest);
+    }
+    return true;
+}
@@ -0,0 +1,106 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "AcousticProbeFile.h"
+#include "MappedFile.h"
+
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Spawnable/RootSpawnableInterface.h>
+
+namespace TuSteamAudio
+{
+    class SimulationManager;
+
+    struct ProbeStreamingSettings
+    {
+        bool m_enabled = true;
+        //! Regions closer than this to the listener are streamed in, in meters.
+        float m_radius = 96.0f;
+        //! Serialized size of all resident and loading regions never goes past this.
+        AZ::u64 m_memoryBudget = 64 * 1024 * 1024;
+        int m_maxLoadsInFlight = 2;
+    };
+
+    //! Reads /TuSteamAudio/Probes from the settings registry.
+    ProbeStreamingSettings ReadProbeStreamingSettings();
+
+    //! Streams the level's baked probe regions in and out around the listener.
+    //! Only the region table is read when a level loads, payloads are loaded by jobs and handed to the
+    //! SimulationManager from Update, which the game thread calls once per frame.
+    class ProbeStreamer
+        : protected AzFramework::RootSpawnableNotificationBus::Handler
+    {
+    public:
+        void Activate(IPLContext context, SimulationManager* simulation, const ProbeStreamingSettings& settings);
+        void Deactivate();
+
+        //! Reads the header and region table of a .saprobes file, memory mapped when it is a loose file.
+        bool Open(const char* path);
+        //! Removes every region from the simulation. Loads still running finish and release their result.
+        void Close();
+
+        //! Game thread. Collects finished loads, evicts regions out of range and starts loading the nearest missing ones.
+        void Update(const IPLVector3& listenerPosition);
+
+        AZ::u64 GetResidentBytes() const { return m_residentBytes; }
+        size_t GetRegionCount() const { return m_regions.size(); }
+
+    protected:
+        // RootSpawnableNotificationBus
+        void OnRootSpawnableReady(AZ::Data::Asset<AzFramework::Spawnable> rootSpawnable, uint32_t generation) override;
+        void OnRootSpawnableReleased(uint32_t generation) override;
+
+    private:
+        //! Outlives the streamer's interest in it, load jobs keep it alive until they are done.
+        struct StreamSource
+        {
+            AZStd::string m_path;
+            MappedFile m_mapped;
+
+            AZStd::mutex m_mutex;
+            //! Region index and its batch, null when the load failed.
+            AZStd::vector<AZStd::pair<size_t, IPLProbeBatch>> m_completed;
+            bool m_closed = false;
+        };
+
+        enum class RegionStatus
+        {
+            Unloaded,
+            Loading,
+            Loaded,
+            Failed
+        };
+
+        struct RegionState
+        {
+            AcousticProbeFile::Region m_region;
+            RegionStatus m_status = RegionStatus::Unloaded;
+            IPLProbeBatch m_probeBatch = nullptr;
+            float m_distance = 0.0f;
+        };
+
+        void CollectCompletedLoads();
+        void StartLoad(size_t regionIndex);
+        void Unload(RegionState& state);
+        //! Frees budget by evicting loaded regions farther away than distance, farthest first.
+        bool MakeRoom(AZ::u64 bytes, float distance);
+
+        IPLContext m_context = nullptr;
+        SimulationManager* m_simulation = nullptr;
+        ProbeStreamingSettings m_settings;
+
+        AZStd::shared_ptr<StreamSource> m_source;
+        AZStd::vector<RegionState> m_regions;
+        //Loading and loaded regions, counted against the budget
+        AZ::u64 m_residentBytes = 0;
+        int m_loadsInFlight = 0;
+        bool m_warnedBudget = false;
+    };
+} // TuSteamAudio
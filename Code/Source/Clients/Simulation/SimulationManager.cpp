@@ -0,0 +1,317 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SimulationManager.h"
+#include "Clients/Scene/AcousticProbeFile.h"
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/algorithm.h>
+
+using namespace TuSteamAudio;
+
+void SimulationManager::Start(IPLSimulator simulator, const DirectSimulationSettings& directSettings,
+    const ReflectionSimulationSettings& reflectionSettings)
+{
+    Stop();
+
+    m_simulator = iplSimulatorRetain(simulator);
+    m_directSettings = directSettings;
+    m_reflectionSettings = reflectionSettings;
+
+    if (m_directSettings.m_enabled)
+    {
+        m_directWorker.Start("TuSteamAudio Direct", m_directSettings.m_updateRate, [this]() { RunDirect(); });
+    }
+
+    if (m_reflectionSettings.m_enabled)
+    {
+        m_reflectionsWorker.Start("TuSteamAudio Reflections", m_reflectionSettings.m_updateRate, [this]() { RunReflections(); });
+    }
+}
+
+void SimulationManager::Stop()
+{
+    m_directWorker.Stop();
+    m_reflectionsWorker.Stop();
+
+    if (m_simulator)
+    {
+        iplSimulatorRelease(&m_simulator);
+        m_simulator = nullptr;
+    }
+    m_commitPending.store(false, AZStd::memory_order_relaxed);
+    m_pendingScene.store(nullptr, AZStd::memory_order_relaxed);
+
+    // The simulator is gone, drop its references along with anything that never got applied
+    AZStd::lock_guard<AZStd::mutex> lock(m_probeBatchMutex);
+    for (IPLProbeBatch& probeBatch : m_probeBatches)
+    {
+        iplProbeBatchRelease(&probeBatch);
+    }
+    m_probeBatches.clear();
+    for (ProbeBatchChange& change : m_pendingProbeBatches)
+    {
+        iplProbeBatchRelease(&change.m_probeBatch);
+    }
+    m_pendingProbeBatches.clear();
+    m_probeBatchCount.store(0, AZStd::memory_order_relaxed);
+}
+
+void SimulationManager::RegisterSource(SimulationSource* source)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_sourcesMutex);
+    m_sources.push_back(source);
+}
+
+void SimulationManager::UnregisterSource(SimulationSource* source)
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_sourcesMutex);
+    auto it = AZStd::find(m_sources.begin(), m_sources.end(), source);
+    if (it != m_sources.end())
+    {
+        *it = m_sources.back();
+        m_sources.pop_back();
+    }
+}
+
+void SimulationManager::SetListener(const IPLCoordinateSpace3& listener)
+{
+    m_listener.Write(listener);
+}
+
+void SimulationManager::RequestCommit()
+{
+    if (!m_simulator)
+    {
+        return;
+    }
+
+    if (!IsAnyWorkerRunning())
+    {
+        ApplyProbeBatchChanges();
+        iplSimulatorCommit(m_simulator);
+        return;
+    }
+
+    m_commitPending.store(true, AZStd::memory_order_release);
+}
+
+void SimulationManager::RequestSceneCommit(IPLScene scene)
+{
+    if (!m_simulator || !scene)
+    {
+        return;
+    }
+
+    if (!IsAnyWorkerRunning())
+    {
+        iplSceneCommit(scene);
+        iplSimulatorSetScene(m_simulator, scene);
+        iplSimulatorCommit(m_simulator);
+        return;
+    }
+
+    m_pendingScene.store(scene, AZStd::memory_order_release);
+    m_commitPending.store(true, AZStd::memory_order_release);
+}
+
+void SimulationManager::AddProbeBatch(IPLProbeBatch probeBatch)
+{
+    if (!m_simulator || !probeBatch)
+    {
+        return;
+    }
+
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_probeBatchMutex);
+        m_pendingProbeBatches.push_back({ iplProbeBatchRetain(probeBatch), true });
+    }
+    m_probeBatchCount.fetch_add(1, AZStd::memory_order_relaxed);
+}
+
+void SimulationManager::RemoveProbeBatch(IPLProbeBatch probeBatch)
+{
+    if (!m_simulator || !probeBatch)
+    {
+        return;
+    }
+
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_probeBatchMutex);
+        m_pendingProbeBatches.push_back({ iplProbeBatchRetain(probeBatch), false });
+    }
+    m_probeBatchCount.fetch_sub(1, AZStd::memory_order_relaxed);
+}
+
+bool SimulationManager::IsUsingBakedReflections() const
+{
+    return m_reflectionSettings.m_useBakedProbes && m_probeBatchCount.load(AZStd::memory_order_relaxed) > 0;
+}
+
+void SimulationManager::ApplyProbeBatchChanges()
+{
+    AZStd::lock_guard<AZStd::mutex> lock(m_probeBatchMutex);
+    for (ProbeBatchChange& change : m_pendingProbeBatches)
+    {
+        if (change.m_add)
+        {
+            iplSimulatorAddProbeBatch(m_simulator, change.m_probeBatch);
+            m_probeBatches.push_back(change.m_probeBatch);
+            continue;
+        }
+
+        auto it = AZStd::find(m_probeBatches.begin(), m_probeBatches.end(), change.m_probeBatch);
+        if (it != m_probeBatches.end())
+        {
+            iplSimulatorRemoveProbeBatch(m_simulator, *it);
+            iplProbeBatchRelease(&*it);
+            *it = m_probeBatches.back();
+            m_probeBatches.pop_back();
+        }
+        iplProbeBatchRelease(&change.m_probeBatch);
+    }
+    m_pendingProbeBatches.clear();
+}
+
+bool SimulationManager::ApplyVirtualSources()
+{
+    bool changed = false;
+    AZStd::lock_guard<AZStd::mutex> lock(m_sourcesMutex);
+    for (SimulationSource* source : m_sources)
+    {
+        const bool simulate = !source->m_virtual.load(AZStd::memory_order_relaxed);
+        if (simulate == source->m_inSimulator)
+        {
+            continue;
+        }
+
+        if (simulate)
+        {
+            iplSourceAdd(source->m_source, m_simulator);
+        }
+        else
+        {
+            iplSourceRemove(source->m_source, m_simulator);
+        }
+        source->m_inSimulator = simulate;
+        changed = true;
+    }
+    return changed;
+}
+
+void SimulationManager::ApplySourceInputs(IPLSimulationFlags flags)
+{
+    // Baked sources only interpolate the probes around the listener, no rays are traced for them
+    const bool baked = (flags & IPL_SIMULATIONFLAGS_REFLECTIONS) && IsUsingBakedReflections();
+
+    AZStd::lock_guard<AZStd::mutex> lock(m_sourcesMutex);
+    for (SimulationSource* source : m_sources)
+    {
+        const IPLSimulationFlags sourceFlags = static_cast<IPLSimulationFlags>(source->m_flags & flags);
+        IPLSimulationInputs inputs{};
+        if (sourceFlags == 0 || !source->m_inSimulator || !source->m_inputs.Read(inputs))
+        {
+            continue;
+        }
+
+        if (sourceFlags & IPL_SIMULATIONFLAGS_REFLECTIONS)
+        {
+            inputs.baked = baked ? IPL_TRUE : IPL_FALSE;
+            inputs.bakedDataIdentifier = AcousticProbeFile::BakedReverb;
+        }
+        iplSourceSetInputs(source->m_source, sourceFlags, &inputs);
+    }
+}
+
+void SimulationManager::PrepareRun(IPLSimulationFlags flags, const IPLSimulationSharedInputs& sharedInputs)
+{
+    // Whichever worker runs first applies the pending commit
+    AZStd::unique_lock<AZStd::shared_mutex> lock(m_simulatorMutex);
+    if (IPLScene scene = m_pendingScene.exchange(nullptr, AZStd::memory_order_acq_rel))
+    {
+        iplSceneCommit(scene);
+        iplSimulatorSetScene(m_simulator, scene);
+    }
+    const bool sourcesChanged = ApplyVirtualSources();
+    if (m_commitPending.exchange(false, AZStd::memory_order_acq_rel))
+    {
+        ApplyProbeBatchChanges();
+        iplSimulatorCommit(m_simulator);
+    }
+    else if (sourcesChanged)
+    {
+        iplSimulatorCommit(m_simulator);
+    }
+    iplSimulatorSetSharedInputs(m_simulator, flags, &sharedInputs);
+    ApplySourceInputs(flags);
+}
+
+void SimulationManager::RunDirect()
+{
+    IPLCoordinateSpace3 listener{};
+    if (!m_listener.Read(listener))
+    {
+        return;
+    }
+
+    IPLSimulationSharedInputs sharedInputs = {};
+    sharedInputs.listener = listener;
+    PrepareRun(IPL_SIMULATIONFLAGS_DIRECT, sharedInputs);
+
+    {
+        AZ_PROFILE_SCOPE(Audio, "SimulationManager::RunDirect");
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_simulatorMutex);
+        iplSimulatorRunDirect(m_simulator);
+    }
+
+    // Publish occlusion/transmission to the render thread
+    AZStd::lock_guard<AZStd::mutex> lock(m_sourcesMutex);
+    for (SimulationSource* source : m_sources)
+    {
+        if ((source->m_flags & IPL_SIMULATIONFLAGS_DIRECT) && source->m_inSimulator)
+        {
+            IPLSimulationOutputs outputs{};
+            iplSourceGetOutputs(source->m_source, IPL_SIMULATIONFLAGS_DIRECT, &outputs);
+            source->m_direct.Write(outputs.direct);
+        }
+    }
+}
+
+void SimulationManager::RunReflections()
+{
+    IPLCoordinateSpace3 listener{};
+    if (!m_listener.Read(listener))
+    {
+        return;
+    }
+
+    IPLSimulationSharedInputs sharedInputs = {};
+    sharedInputs.listener = listener;
+    sharedInputs.numRays = m_reflectionSettings.m_numRays;
+    sharedInputs.numBounces = m_reflectionSettings.m_numBounces;
+    sharedInputs.duration = m_reflectionSettings.m_duration;
+    sharedInputs.order = m_reflectionSettings.m_order;
+    sharedInputs.irradianceMinDistance = m_reflectionSettings.m_irradianceMinDistance;
+    PrepareRun(IPL_SIMULATIONFLAGS_REFLECTIONS, sharedInputs);
+
+    {
+        AZ_PROFILE_SCOPE(Audio, "SimulationManager::RunReflections");
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_simulatorMutex);
+        iplSimulatorRunReflections(m_simulator);
+    }
+
+    // Publish to the render thread, each source gets its own double buffer
+    AZStd::lock_guard<AZStd::mutex> lock(m_sourcesMutex);
+    for (SimulationSource* source : m_sources)
+    {
+        if ((source->m_flags & IPL_SIMULATIONFLAGS_REFLECTIONS) && source->m_inSimulator)
+        {
+            IPLSimulationOutputs outputs{};
+            iplSourceGetOutputs(source->m_source, IPL_SIMULATIONFLAGS_REFLECTIONS, &outputs);
+            source->m_reflections.Write(outputs.reflections);
+        }
+    }
+}
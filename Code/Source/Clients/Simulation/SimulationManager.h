@@ -0,0 +1,134 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include "phonon.h"
+#include "SimulationOutputBuffer.h"
+#include "SimulationWorker.h"
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+
+namespace TuSteamAudio
+{
+    //! Per source simulation results, published by the simulation threads and read by the render thread.
+    struct SimulationSource
+    {
+        IPLSource m_source = nullptr;
+        //! Which of the simulations below this source takes part in.
+        IPLSimulationFlags m_flags = IPL_SIMULATIONFLAGS_DIRECT;
+        //! Published by the game thread, applied by the simulation threads before each run.
+        SimulationOutputBuffer<IPLSimulationInputs> m_inputs;
+        SimulationOutputBuffer<IPLDirectEffectParams> m_direct;
+        SimulationOutputBuffer<IPLReflectionEffectParams> m_reflections;
+        //! Set while the source is virtual, the simulation threads then take it out of the simulator.
+        AZStd::atomic_bool m_virtual{ false };
+        //! Whether the source is currently added to the simulator. Written by the simulation threads under
+        //! the sources lock, so the owner can read it once UnregisterSource has returned.
+        bool m_inSimulator = true;
+    };
+
+    struct DirectSimulationSettings
+    {
+        bool m_enabled = true;
+        float m_updateRate = 30.0f;
+        IPLOcclusionType m_occlusionType = IPL_OCCLUSIONTYPE_RAYCAST;
+        int m_numOcclusionSamples = 32;
+        int m_numTransmissionRays = 32;
+    };
+
+    struct ReflectionSimulationSettings
+    {
+        bool m_enabled = false;
+        float m_updateRate = 10.0f;
+        int m_numRays = 4096;
+        int m_numBounces = 16;
+        float m_duration = 2.0f;
+        int m_order = 1;
+        float m_irradianceMinDistance = 1.0f;
+        //! Seconds a source may go without reflections applied before its convolution state is freed.
+        float m_idleReleaseTime = 1.0f;
+        //! Sources feed one listener side reflection mixer instead of each convolving and decoding on their own.
+        bool m_sharedMixer = true;
+        //! Sources read reverb from the level's baked probes when it has any, rays are only traced without them.
+        bool m_useBakedProbes = true;
+    };
+
+    //! Runs Steam Audio simulation off the game thread.
+    //! The game thread only publishes the listener and requests commits, it never waits on ray tracing.
+    class SimulationManager
+    {
+    public:
+        void Start(IPLSimulator simulator, const DirectSimulationSettings& directSettings, const ReflectionSimulationSettings& reflectionSettings);
+        void Stop();
+
+        const DirectSimulationSettings& GetDirectSettings() const { return m_directSettings; }
+        bool IsDirectEnabled() const { return m_directWorker.IsRunning(); }
+
+        const ReflectionSimulationSettings& GetReflectionSettings() const { return m_reflectionSettings; }
+        bool IsReflectionsEnabled() const { return m_reflectionsWorker.IsRunning(); }
+
+        //! Game thread. The source must stay alive until UnregisterSource returns.
+        void RegisterSource(SimulationSource* source);
+        void UnregisterSource(SimulationSource* source);
+
+        //! Game thread, picked up by the next simulation run.
+        void SetListener(const IPLCoordinateSpace3& listener);
+        //! Game thread. Commits immediately if no simulation thread is running,
+        //! otherwise the next simulation run commits before it simulates.
+        void RequestCommit();
+        //! Game thread. Commits the scene's added/removed meshes the same way and makes it the simulated scene.
+        void RequestSceneCommit(IPLScene scene);
+
+        //! Game thread. Queued until the next RequestCommit, so a frame's worth of changes costs a single commit.
+        //! The simulator holds its own reference until the removal is applied.
+        void AddProbeBatch(IPLProbeBatch probeBatch);
+        void RemoveProbeBatch(IPLProbeBatch probeBatch);
+        //! True while sources are simulated from baked probes instead of traced rays.
+        bool IsUsingBakedReflections() const;
+
+    private:
+        bool IsAnyWorkerRunning() const { return m_directWorker.IsRunning() || m_reflectionsWorker.IsRunning(); }
+        void PrepareRun(IPLSimulationFlags flags, const IPLSimulationSharedInputs& sharedInputs);
+        void ApplyProbeBatchChanges();
+        //! Removes virtual sources from the simulator and adds them back once they are heard again.
+        //! Returns true if the simulator needs a commit.
+        bool ApplyVirtualSources();
+        void ApplySourceInputs(IPLSimulationFlags flags);
+        void RunDirect();
+        void RunReflections();
+
+        IPLSimulator m_simulator = nullptr;
+        DirectSimulationSettings m_directSettings;
+        ReflectionSimulationSettings m_reflectionSettings;
+
+        SimulationWorker m_directWorker;
+        SimulationWorker m_reflectionsWorker;
+        SimulationOutputBuffer<IPLCoordinateSpace3> m_listener;
+
+        //Simulation runs share the simulator, commits and shared inputs take it exclusively
+        AZStd::shared_mutex m_simulatorMutex;
+        AZStd::atomic_bool m_commitPending{ false };
+        AZStd::atomic<IPLScene> m_pendingScene{ nullptr };
+
+        struct ProbeBatchChange
+        {
+            IPLProbeBatch m_probeBatch = nullptr;
+            bool m_add = true;
+        };
+        AZStd::mutex m_probeBatchMutex;
+        AZStd::vector<ProbeBatchChange> m_pendingProbeBatches;
+        //Owned by whoever holds m_simulatorMutex exclusively
+        AZStd::vector<IPLProbeBatch> m_probeBatches;
+        AZStd::atomic_int m_probeBatchCount{ 0 };
+
+        AZStd::mutex m_sourcesMutex;
+        AZStd::vector<SimulationSource*> m_sources;
+    };
+} // TuSteamAudio
@@ -0,0 +1,72 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/typetraits/is_trivially_copyable.h>
+
+namespace TuSteamAudio
+{
+    //! Double buffered value for one writer thread and one or more reader threads.
+    //! The writer fills the back slot and flips it to the front, readers copy the front slot
+    //! and retry if it was flipped mid copy. Neither side ever takes a lock.
+    template<typename T>
+    class SimulationOutputBuffer
+    {
+        static_assert(AZStd::is_trivially_copyable_v<T>, "SimulationOutputBuffer copies values without synchronization");
+    public:
+        //! Writer thread only.
+        void Write(const T& value)
+        {
+            const AZ::u32 back = m_front.load(AZStd::memory_order_relaxed) ^ 1;
+
+            // Odd sequence marks the slot as being written
+            m_sequence[back].fetch_add(1, AZStd::memory_order_relaxed);
+            AZStd::atomic_thread_fence(AZStd::memory_order_release);
+            m_values[back] = value;
+            m_sequence[back].fetch_add(1, AZStd::memory_order_release);
+
+            m_front.store(back, AZStd::memory_order_release);
+        }
+
+        //! Any thread. Returns false if nothing was written yet or the writer kept racing the copy,
+        //! in which case the caller should keep using its previous value.
+        bool Read(T& out) const
+        {
+            for (int attempt = 0; attempt < MaxReadAttempts; ++attempt)
+            {
+                const AZ::u32 front = m_front.load(AZStd::memory_order_acquire);
+                const AZ::u32 before = m_sequence[front].load(AZStd::memory_order_acquire);
+                if (before == 0)
+                {
+                    return false;
+                }
+                if (before & 1)
+                {
+                    continue;
+                }
+
+                out = m_values[front];
+
+                AZStd::atomic_thread_fence(AZStd::memory_order_acquire);
+                if (m_sequence[front].load(AZStd::memory_order_relaxed) == before)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+        static constexpr int MaxReadAttempts = 4;
+
+        T m_values[2] = {};
+        AZStd::atomic<AZ::u32> m_sequence[2] = { 0, 0 };
+        AZStd::atomic<AZ::u32> m_front{ 0 };
+    };
+} // TuSteamAudio
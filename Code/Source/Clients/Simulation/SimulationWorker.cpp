@@ -0,0 +1,76 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "SimulationWorker.h"
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <TuSteamAudio/Allocators.h>
+
+using namespace TuSteamAudio;
+
+SimulationWorker::~SimulationWorker()
+{
+    Stop();
+}
+
+void SimulationWorker::Start(const char* name, float rateHz, Job job)
+{
+    Stop();
+
+    m_name = name;
+    m_job = AZStd::move(job);
+    SetRate(rateHz);
+    m_running.store(true, AZStd::memory_order_release);
+
+    AZStd::thread_desc desc;
+    desc.m_name = m_name.c_str();
+    m_thread = AZStd::thread(desc, [this]() { Run(); });
+}
+
+void SimulationWorker::Stop()
+{
+    if (!m_thread.joinable())
+    {
+        return;
+    }
+
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_wakeMutex);
+        m_running.store(false, AZStd::memory_order_release);
+    }
+    m_wake.notify_all();
+    m_thread.join();
+    m_job = {};
+}
+
+void SimulationWorker::SetRate(float rateHz)
+{
+    m_rateHz.store(AZ::GetClamp(rateHz, 0.1f, 1000.0f), AZStd::memory_order_relaxed);
+}
+
+void SimulationWorker::Run()
+{
+    const PhononAllocationScope allocationScope(PhononAllocationCategory::Simulation);
+    while (m_running.load(AZStd::memory_order_acquire))
+    {
+        const auto start = AZStd::chrono::steady_clock::now();
+        {
+            AZ_PROFILE_SCOPE(Audio, "SimulationWorker: %s", m_name.c_str());
+            m_job();
+        }
+        const auto end = AZStd::chrono::steady_clock::now();
+
+        const auto elapsed = AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(end - start);
+        m_lastRunTimeMs.store(elapsed.count() / 1000.0f, AZStd::memory_order_relaxed);
+
+        // Keep a steady rate, a slow run just starts the next one straight away
+        const auto period = AZStd::chrono::microseconds(static_cast<AZ::s64>(1000000.0f / m_rateHz.load(AZStd::memory_order_relaxed)));
+        AZStd::unique_lock<AZStd::mutex> lock(m_wakeMutex);
+        m_wake.wait_until(lock, start + period, [this]() { return !m_running.load(AZStd::memory_order_acquire); });
+    }
+}
@@ -0,0 +1,50 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/string/string.h>
+
+namespace TuSteamAudio
+{
+    //! Dedicated thread that runs a job at a fixed rate, independent of the game frame rate.
+    class SimulationWorker
+    {
+    public:
+        using Job = AZStd::function<void()>;
+
+        ~SimulationWorker();
+
+        void Start(const char* name, float rateHz, Job job);
+        void Stop();
+        bool IsRunning() const { return m_running.load(AZStd::memory_order_acquire); }
+
+        void SetRate(float rateHz);
+        float GetRate() const { return m_rateHz.load(AZStd::memory_order_relaxed); }
+
+        //! Duration of the last job run in milliseconds.
+        float GetLastRunTimeMs() const { return m_lastRunTimeMs.load(AZStd::memory_order_relaxed); }
+
+    private:
+        void Run();
+
+        AZStd::string m_name;
+        Job m_job;
+        AZStd::thread m_thread;
+
+        AZStd::mutex m_wakeMutex;
+        AZStd::condition_variable m_wake;
+
+        AZStd::atomic_bool m_running{ false };
+        AZStd::atomic<float> m_rateHz{ 10.0f };
+        AZStd::atomic<float> m_lastRunTimeMs{ 0.0f };
+    };
+} // TuSteamAudio
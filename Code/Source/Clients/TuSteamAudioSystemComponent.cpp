@@ -9,15 +9,29 @@
 #include <TuSteamAudio/TuSteamAudioTypeIds.h>
 #include <TuSteamAudio/Utils.h>
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/algorithm.h>
 #include <phonon.h>
 #include <Sune/SuneBus.h>
 
 #include "Effects/SteamAudioHrtf.h"
+#include "Effects/SteamAudioSpatialMixer.h"
+#include "Effects/SteamAudioReflectionMixer.h"
+#include "Effects/SteamAudioSpatialSource.h"
+#include "Hrtf/HrtfFile.h"
+#include "PhononAllocator.h"
+#include "Scene/MappedFile.h"
 #include "TuSteamAudio/Allocators.h"
 
 namespace TuSteamAudio
 {
+    AZ_CVAR(bool, sa_AssertRealtimeAllocations, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Asserts whenever Steam Audio allocates or frees memory inside a RealtimeScope, i.e. on the audio render thread");
+
     AZ_COMPONENT_IMPL(TuSteamAudioSystemComponent, "TuSteamAudioSystemComponent",
         TuSteamAudioSystemComponentTypeId);
 
@@ -71,17 +85,256 @@ namespace TuSteamAudio
     {
     }
 
-    static AZ::IAllocator* allocator = nullptr;
+    namespace Settings
+    {
+        static constexpr const char* RenderMode = "/TuSteamAudio/Spatializer/RenderMode";
+        static constexpr const char* AmbisonicsOrder = "/TuSteamAudio/Spatializer/AmbisonicsOrder";
+        static constexpr const char* FrameSize = "/TuSteamAudio/Spatializer/FrameSize";
+        static constexpr const char* HrtfPath = "/TuSteamAudio/Hrtf/Path";
+        static constexpr const char* Direct = "/TuSteamAudio/Simulation/Direct";
+        static constexpr const char* Reflections = "/TuSteamAudio/Simulation/Reflections";
+        static constexpr const char* Audibility = "/TuSteamAudio/Audibility";
+        static constexpr const char* Quality = "/TuSteamAudio/Quality";
+        static constexpr const char* SpatializerPool = "/TuSteamAudio/SpatializerPool";
+    }
+
+    static constexpr const char* InitStageNames[] = { "Context", "Hrtf", "Scene", "Simulator", "Spatializers" };
+    static_assert(AZ_ARRAY_SIZE(InitStageNames) == static_cast<size_t>(InitStage::Count), "Every init stage needs a name");
+
+    static DirectSimulationSettings ReadDirectSettings()
+    {
+        DirectSimulationSettings settings;
+        auto* registry = AZ::SettingsRegistry::Get();
+        if (!registry)
+        {
+            return settings;
+        }
+
+        const AZStd::string path = Settings::Direct;
+        AZ::s64 value = 0;
+        double number = 0.0;
+        AZStd::string occlusionType;
+
+        registry->Get(settings.m_enabled, path + "/Enabled");
+        if (registry->Get(number, path + "/UpdateRate"))
+        {
+            settings.m_updateRate = static_cast<float>(number);
+        }
+        if (registry->Get(occlusionType, path + "/OcclusionType"))
+        {
+            settings.m_occlusionType = occlusionType == "Volumetric" ? IPL_OCCLUSIONTYPE_VOLUMETRIC : IPL_OCCLUSIONTYPE_RAYCAST;
+        }
+        if (registry->Get(value, path + "/NumOcclusionSamples"))
+        {
+            settings.m_numOcclusionSamples = static_cast<int>(value);
+        }
+        if (registry->Get(value, path + "/NumTransmissionRays"))
+        {
+            settings.m_numTransmissionRays = static_cast<int>(value);
+        }
+        return settings;
+    }
+
+    static ReflectionSimulationSettings ReadReflectionSettings()
+    {
+        ReflectionSimulationSettings settings;
+        auto* registry = AZ::SettingsRegistry::Get();
+        if (!registry)
+        {
+            return settings;
+        }
+
+        const AZStd::string path = Settings::Reflections;
+        AZ::s64 value = 0;
+        double number = 0.0;
+
+        registry->Get(settings.m_enabled, path + "/Enabled");
+        registry->Get(settings.m_sharedMixer, path + "/SharedMixer");
+        registry->Get(settings.m_useBakedProbes, path + "/UseBakedProbes");
+        if (registry->Get(number, path + "/UpdateRate"))
+        {
+            settings.m_updateRate = static_cast<float>(number);
+        }
+        if (registry->Get(value, path + "/NumRays"))
+        {
+            settings.m_numRays = static_cast<int>(value);
+        }
+        if (registry->Get(value, path + "/NumBounces"))
+        {
+            settings.m_numBounces = static_cast<int>(value);
+        }
+        if (registry->Get(value, path + "/Order"))
+        {
+            settings.m_order = static_cast<int>(value);
+        }
+        if (registry->Get(number, path + "/Duration"))
+        {
+            settings.m_duration = static_cast<float>(number);
+        }
+        if (registry->Get(number, path + "/IdleReleaseTime"))
+        {
+            settings.m_idleReleaseTime = static_cast<float>(number);
+        }
+        return settings;
+    }
+
+    static AudibilitySettings ReadAudibilitySettings()
+    {
+        AudibilitySettings settings;
+        auto* registry = AZ::SettingsRegistry::Get();
+        if (!registry)
+        {
+            return settings;
+        }
+
+        const AZStd::string path = Settings::Audibility;
+        AZ::s64 value = 0;
+        double number = 0.0;
+
+        registry->Get(settings.m_enabled, path + "/Enabled");
+        if (registry->Get(number, path + "/VirtualThreshold"))
+        {
+            settings.m_virtualThreshold = static_cast<float>(number);
+        }
+        if (registry->Get(number, path + "/PanningThreshold"))
+        {
+            settings.m_panningThreshold = static_cast<float>(number);
+        }
+        if (registry->Get(value, path + "/MaxFullVoices"))
+        {
+            settings.m_maxFullVoices = static_cast<AZ::u32>(AZStd::max(value, AZ::s64(0)));
+        }
+        if (registry->Get(number, path + "/CpuBudgetMs"))
+        {
+            settings.m_cpuBudgetMs = static_cast<float>(number);
+        }
+        if (registry->Get(number, path + "/CrossfadeTime"))
+        {
+            settings.m_crossfadeTime = static_cast<float>(number);
+        }
+        return settings;
+    }
+
+    static SpatializerPoolSettings ReadSpatializerPoolSettings()
+    {
+        SpatializerPoolSettings settings;
+        auto* registry = AZ::SettingsRegistry::Get();
+        if (!registry)
+        {
+            return settings;
+        }
+
+        const AZStd::string path = Settings::SpatializerPool;
+        AZ::s64 value = 0;
+
+        if (registry->Get(value, path + "/Prewarm"))
+        {
+            settings.m_prewarm = static_cast<AZ::u32>(AZStd::max(value, AZ::s64(0)));
+        }
+        if (registry->Get(value, path + "/MaxSize"))
+        {
+            settings.m_maxSize = static_cast<AZ::u32>(AZStd::max(value, AZ::s64(0)));
+        }
+        return settings;
+    }
+
+    static QualitySettings ReadQualitySettings()
+    {
+        QualitySettings settings;
+        auto* registry = AZ::SettingsRegistry::Get();
+        if (!registry)
+        {
+            return settings;
+        }
+
+        const AZStd::string path = Settings::Quality;
+        double number = 0.0;
+        AZStd::string quality;
+
+        registry->Get(settings.m_automatic, path + "/Automatic");
+        if (registry->Get(quality, path + "/Quality"))
+        {
+            if (quality == "Nearest")
+            {
+                settings.m_quality = SpatialQuality::Nearest;
+            }
+            else if (quality == "Panning")
+            {
+                settings.m_quality = SpatialQuality::Panning;
+            }
+            else if (quality == "StereoPan")
+            {
+                settings.m_quality = SpatialQuality::StereoPan;
+            }
+        }
+        if (registry->Get(number, path + "/Budget"))
+        {
+            settings.m_budget = static_cast<float>(number);
+        }
+        if (registry->Get(number, path + "/DowngradeTime"))
+        {
+            settings.m_downgradeTime = static_cast<float>(number);
+        }
+        if (registry->Get(number, path + "/UpgradeTime"))
+        {
+            settings.m_upgradeTime = static_cast<float>(number);
+        }
+        if (registry->Get(number, path + "/UpgradeHeadroom"))
+        {
+            settings.m_upgradeHeadroom = static_cast<float>(number);
+        }
+        return settings;
+    }
+
+    // Outlives the context, Steam Audio may still free from its own threads while it shuts down
+    static PhononAllocator allocator;
 
     [[maybe_unused]]static void* saAlloc(IPLsize size, IPLsize alignment)
     {
-        return allocator->allocate(size, alignment);
+        // Pooled blocks don't lock, but growing a pool or a large block still goes through SystemAllocator
+        AZ_Assert(!(sa_AssertRealtimeAllocations && RealtimeScope::IsActive()),
+            "Steam Audio allocated %zu bytes on the audio render thread", static_cast<size_t>(size));
+        return allocator.Allocate(size, alignment);
     }
 
     [[maybe_unused]]static void saFree(void* ptr)
     {
-        allocator->deallocate(ptr);
+        AZ_Assert(!(sa_AssertRealtimeAllocations && RealtimeScope::IsActive()), "Steam Audio freed memory on the audio render thread");
+        allocator.Free(ptr);
+    }
+
+    static void sa_PrintAllocatorStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        static constexpr const char* CategoryNames[PhononAllocationCategoryCount] = { "General", "Render", "Simulation", "Scene", "Probes", "Reflections" };
+        for (int category = 0; category < PhononAllocationCategoryCount; ++category)
+        {
+            const PhononAllocationStats stats = allocator.GetStats(static_cast<PhononAllocationCategory>(category));
+            AZ_Info("TuSteamAudio", "%-10s live %" PRIu64 " bytes, peak %" PRIu64 " bytes, %" PRIu64 " allocations, %" PRIu64 " frees",
+                CategoryNames[category], stats.m_liveBytes, stats.m_peakBytes, stats.m_allocations, stats.m_frees);
+        }
+        AZ_Info("TuSteamAudio", "%" PRIu64 " bytes reserved in pools", allocator.GetReservedBytes());
+    }
+    AZ_CONSOLEFREEFUNC(sa_PrintAllocatorStats, AZ::ConsoleFunctorFlags::Null, "Prints what Steam Audio has allocated, per allocation category");
+
+    static void sa_PrintSpatializerPoolStats([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (auto* requests = TuSteamAudioInterface::Get())
+        {
+            const SpatializerPoolStats stats = requests->GetSpatializerPoolStats();
+            AZ_Info("TuSteamAudio", "Spatializer pool: %" PRIu64 " hits, %" PRIu64 " misses, %" PRIu64 " discarded, %u free, %u pending",
+                stats.m_hits, stats.m_misses, stats.m_discarded, stats.m_free, stats.m_pending);
+        }
     }
+    AZ_CONSOLEFREEFUNC(sa_PrintSpatializerPoolStats, AZ::ConsoleFunctorFlags::Null, "Prints how often SteamAudioHrtf effects reused a pooled node");
+
+    static void sa_SetHrtf(const AZ::ConsoleCommandContainer& arguments)
+    {
+        if (auto* requests = TuSteamAudioInterface::Get())
+        {
+            requests->SetHrtf(arguments.empty() ? AZStd::string() : AZStd::string(arguments.front()));
+        }
+    }
+    AZ_CONSOLEFREEFUNC(sa_SetHrtf, AZ::ConsoleFunctorFlags::Null, "Crossfades to the .sahrtf product given, or to the default HRTF without one");
 
     static void saLog(IPLLogLevel level, const char* message)
     {
@@ -102,9 +355,93 @@ namespace TuSteamAudio
         }
     }
 
+    //! The .sahrtf product at path, built and measured by the asset processor ahead of time.
+    //! Steam Audio's default HRTF when the path is empty or the product can't be loaded.
+    static IPLHRTF CreateHrtf(IPLContext context, IPLAudioSettings audioSettings, const AZStd::string& path)
+    {
+        IPLHRTF hrtf = nullptr;
+        if (!path.empty())
+        {
+            const bool read = ReadProduct(path.c_str(), [context, &audioSettings, &hrtf](const void* data, size_t size)
+            {
+                hrtf = HrtfFile::Create(context, audioSettings, data, size);
+            });
+            AZ_Warning("TuSteamAudio", hrtf, "Failed to %s HRTF '%s', using the default HRTF", read ? "load" : "read", path.c_str());
+        }
+
+        if (!hrtf)
+        {
+            IPLHRTFSettings hrtfSettings = {};
+            hrtfSettings.type = IPL_HRTFTYPE_DEFAULT;
+            hrtfSettings.volume = 1.0f;
+            iplHRTFCreate(context, &audioSettings, &hrtfSettings, &hrtf);
+        }
+        return hrtf;
+    }
+
     void TuSteamAudioSystemComponent::Activate()
     {
-        allocator = &AZ::AllocatorInstance<SteamAudioAllocator>::Get();
+        m_activateTime = AZStd::chrono::steady_clock::now();
+        m_stageTimes = {};
+        m_failedStage = InitStage::Count;
+
+        // 0 follows the device period. Anything else decouples Steam Audio from LabSound's quantum,
+        // the spatializers then reblock and report the extra latency.
+        const int periodSize = Sune::SuneInterface::Get()->GetPeriodSizeInFrames();
+        AZ::s64 frameSize = 0;
+        AZ::s64 ambisonicsOrder = 2;
+        AZStd::string renderMode = "Binaural";
+        m_initHrtfPath.clear();
+        if (auto* registry = AZ::SettingsRegistry::Get())
+        {
+            registry->Get(frameSize, Settings::FrameSize);
+            registry->Get(ambisonicsOrder, Settings::AmbisonicsOrder);
+            registry->Get(renderMode, Settings::RenderMode);
+            registry->Get(m_initHrtfPath, Settings::HrtfPath);
+        }
+
+        m_audioSettings = {};
+        m_audioSettings.frameSize = frameSize > 0 ? static_cast<IPLint32>(frameSize) : periodSize;
+        m_audioSettings.samplingRate = Sune::SuneInterface::Get()->GetLabContext()->sampleRate();
+        m_initAmbisonicsOrder = AZ::GetClamp(static_cast<int>(ambisonicsOrder), 1, 3);
+        SetSpatialRenderMode(renderMode == "Ambisonics" ? SpatialRenderMode::Ambisonics : SpatialRenderMode::Binaural);
+
+        m_directSettings = ReadDirectSettings();
+        m_reflectionSettings = ReadReflectionSettings();
+        m_audibility.SetSettings(ReadAudibilitySettings());
+        m_quality.SetSettings(ReadQualitySettings());
+        m_spatializerPool.SetSettings(ReadSpatializerPoolSettings());
+
+        // Effects can be created right away, they pan plainly until the system is Ready
+        SetReadiness(SystemReadiness::Initializing);
+        TuSteamAudioRequestBus::Handler::BusConnect();
+        Sune::PlayerEffectFactoryBus::MultiHandler::BusConnect(SteamAudioHrtf::RegisterName);
+        Sune::PlayerEffectFactoryBus::MultiHandler::BusConnect(SteamAudioSpatialSource::RegisterName);
+        AZ::TickBus::Handler::BusConnect();
+
+        // Context, HRTF, scene and simulator don't touch LabSound or the game, OnTick finishes the rest once they're done
+        m_initJobDone.store(false, AZStd::memory_order_relaxed);
+        AZ::Job* job = AZ::CreateJobFunction([this]()
+        {
+            AZ_PROFILE_SCOPE(Audio, "TuSteamAudio::Initialize");
+            m_failedStage = RunInitStages();
+            m_initJobDone.store(true, AZStd::memory_order_release);
+        }, true);
+        job->SetDependent(&m_initCompletion);
+        job->Start();
+        m_initJobStarted = true;
+    }
+
+    InitStage TuSteamAudioSystemComponent::RunInitStages()
+    {
+        auto stageStart = AZStd::chrono::steady_clock::now();
+        const auto endStage = [this, &stageStart](InitStage stage)
+        {
+            const auto now = AZStd::chrono::steady_clock::now();
+            m_stageTimes[static_cast<size_t>(stage)] = AZStd::chrono::duration<double>(now - stageStart).count() * 1000.0;
+            stageStart = now;
+        };
+
         IPLContextSettings contextSettings = {};
         contextSettings.version = STEAMAUDIO_VERSION;
         contextSettings.logCallback = &saLog;
@@ -113,46 +450,47 @@ namespace TuSteamAudio
         contextSettings.flags = IPL_CONTEXTFLAGS_VALIDATION;
 
         IPLerror err = iplContextCreate(&contextSettings, &m_context);
+        endStage(InitStage::Context);
         if (err != IPL_STATUS_SUCCESS)
         {
-            AZ_Error("TuSteamAudio", false, "Failed to create Phonon context.");
-            return;
+            m_context = nullptr;
+            return InitStage::Context;
         }
 
-        m_audioSettings = {};
-        m_audioSettings.frameSize = Sune::SuneInterface::Get()->GetPeriodSizeInFrames();
-        m_audioSettings.samplingRate = Sune::SuneInterface::Get()->GetLabContext()->sampleRate();
-
-        IPLHRTFSettings hrtfSettings = {};
-        hrtfSettings.type = IPL_HRTFTYPE_DEFAULT;
-        hrtfSettings.volume = 1.0f;
-
-        err = iplHRTFCreate(m_context, &m_audioSettings, &hrtfSettings, &m_hrtf);
-        if (err != IPL_STATUS_SUCCESS)
+        m_hrtf = CreateHrtf(m_context, m_audioSettings, m_initHrtfPath);
+        if (m_hrtf && !m_ambisonicsBus.Create(m_context, m_audioSettings, m_hrtf, m_initAmbisonicsOrder))
         {
-            AZ_Error("TuSteamAudio", false, "Failed to create Phonon HRTF.");
-            return;
+            AZ_Warning("TuSteamAudio", false, "Ambisonics render mode unavailable.");
+        }
+        endStage(InitStage::Hrtf);
+        if (!m_hrtf)
+        {
+            return InitStage::Hrtf;
         }
 
         IPLSceneSettings sceneSettings = {};
         sceneSettings.type = IPL_SCENETYPE_DEFAULT;
-
         err = iplSceneCreate(m_context, &sceneSettings, &m_scene);
+        endStage(InitStage::Scene);
         if (err != IPL_STATUS_SUCCESS)
         {
-            AZ_Error("TuSteamAudio", false, "Failed to create Phonon scene.");
-            return;
+            m_scene = nullptr;
+            return InitStage::Scene;
         }
 
         IPLSimulationSettings simulationSettings = {};
         simulationSettings.flags = IPL_SIMULATIONFLAGS_DIRECT;
+        if (m_reflectionSettings.m_enabled)
+        {
+            simulationSettings.flags = static_cast<IPLSimulationFlags>(simulationSettings.flags | IPL_SIMULATIONFLAGS_REFLECTIONS);
+        }
         simulationSettings.sceneType = sceneSettings.type;
         simulationSettings.reflectionType = IPL_REFLECTIONEFFECTTYPE_CONVOLUTION;
-        simulationSettings.maxNumOcclusionSamples = 32;
-        simulationSettings.maxNumRays = 4096;
+        simulationSettings.maxNumOcclusionSamples = m_directSettings.m_numOcclusionSamples;
+        simulationSettings.maxNumRays = m_reflectionSettings.m_numRays;
         simulationSettings.numDiffuseSamples = 32;
-        simulationSettings.maxDuration = 2.0f;
-        simulationSettings.maxOrder = 1;
+        simulationSettings.maxDuration = m_reflectionSettings.m_duration;
+        simulationSettings.maxOrder = m_reflectionSettings.m_order;
         simulationSettings.maxNumSources = 24;
         simulationSettings.numThreads = 4;
         simulationSettings.numVisSamples = 32;
@@ -160,77 +498,353 @@ namespace TuSteamAudio
         simulationSettings.frameSize = m_audioSettings.frameSize;
 
         err = iplSimulatorCreate(m_context, &simulationSettings, &m_simulator);
+        if (err == IPL_STATUS_SUCCESS)
+        {
+            m_simulationSettings = simulationSettings;
+            iplSimulatorSetScene(m_simulator, m_scene);
+            iplSimulatorCommit(m_simulator);
+        }
+        endStage(InitStage::Simulator);
         if (err != IPL_STATUS_SUCCESS)
         {
-            AZ_Error("TuSteamAudio", false, "Failed to create Phonon simulator.");
+            m_simulator = nullptr;
+            return InitStage::Simulator;
+        }
+
+        return InitStage::Count;
+    }
+
+    void TuSteamAudioSystemComponent::FinishInitialization()
+    {
+        // Already done, this only lets the completion be reused by the next activation
+        m_initCompletion.StartAndWaitForCompletion();
+        m_initCompletion.Reset(true);
+        m_initJobStarted = false;
+
+        if (m_failedStage != InitStage::Count)
+        {
+            AZ_Error("TuSteamAudio", false, "Steam Audio failed to initialize in the %s stage, spatializers stay on plain panning.",
+                InitStageNames[static_cast<size_t>(m_failedStage)]);
+            ReleasePhonon();
+            SetReadiness(SystemReadiness::Failed);
             return;
         }
 
-        Sune::PlayerEffectFactoryBus::MultiHandler::BusConnect(SteamAudioHrtf::RegisterName);
+        const auto stageStart = AZStd::chrono::steady_clock::now();
 
-        TuSteamAudioRequestBus::Handler::BusConnect();
-        AZ::TickBus::Handler::BusConnect();
+        // Getters hand out the Phonon objects from here on, the nodes created below need them
+        m_readiness.store(SystemReadiness::Ready, AZStd::memory_order_release);
+        if (m_ambisonicsBus.IsValid())
+        {
+            RegisterHrtfClient(&m_ambisonicsBus);
+        }
+        // Requested before the bus existed, falls back to Binaural now if it couldn't be created
+        SetSpatialRenderMode(m_renderMode.load(AZStd::memory_order_relaxed));
+
+        m_simulation.Start(m_simulator, m_directSettings, m_reflectionSettings);
+        m_sceneBuilder.Activate(m_context, m_scene, &m_simulation, ReadAcousticSceneSettings());
+        m_probeStreamer.Activate(m_context, &m_simulation, ReadProbeStreamingSettings());
+
+        // Shared spatializer for batched sources, fed by SteamAudioSpatialSource taps
+        auto labContext = Sune::SuneInterface::Get()->GetLabContext();
+        m_spatialMixer = std::make_shared<SteamAudioSpatialMixerNode>(*labContext);
+        labContext->connect(labContext->destinationNode(), m_spatialMixer);
+
+        // One convolution + decode per quantum for every reflecting source
+        // It mixes one frame of contributions per render, so frames shorter than a quantum keep the per source decode
+        const int periodSize = Sune::SuneInterface::Get()->GetPeriodSizeInFrames();
+        const bool sharedReflectionMixer = m_reflectionSettings.m_sharedMixer && m_audioSettings.frameSize >= periodSize;
+        AZ_Warning("TuSteamAudio", !m_reflectionSettings.m_enabled || !m_reflectionSettings.m_sharedMixer || sharedReflectionMixer,
+            "Shared reflection mixer disabled, FrameSize %d is shorter than the device period %d", m_audioSettings.frameSize, periodSize);
+        if (m_reflectionSettings.m_enabled && sharedReflectionMixer)
+        {
+            const int irSize = static_cast<int>(m_audioSettings.samplingRate * m_simulationSettings.maxDuration);
+            m_reflectionMixer = std::make_shared<SteamAudioReflectionMixerNode>(*labContext, m_simulationSettings.maxOrder, irSize);
+            labContext->connect(labContext->destinationNode(), m_reflectionMixer);
+        }
+
+        // Nodes for the first players, the ones they release come back here
+        m_spatializerPool.Prewarm(*labContext);
+
+        m_stageTimes[static_cast<size_t>(InitStage::Spatializers)] =
+            AZStd::chrono::duration<double>(AZStd::chrono::steady_clock::now() - stageStart).count() * 1000.0;
+
+        AZ_Info("TuSteamAudio", "Ready %.1f ms after activation. Context %.1f ms, HRTF %.1f ms, scene %.1f ms, simulator %.1f ms, spatializers %.1f ms",
+            AZStd::chrono::duration<double>(AZStd::chrono::steady_clock::now() - m_activateTime).count() * 1000.0,
+            m_stageTimes[static_cast<size_t>(InitStage::Context)], m_stageTimes[static_cast<size_t>(InitStage::Hrtf)],
+            m_stageTimes[static_cast<size_t>(InitStage::Scene)], m_stageTimes[static_cast<size_t>(InitStage::Simulator)],
+            m_stageTimes[static_cast<size_t>(InitStage::Spatializers)]);
+
+        // Effects created while initializing upgrade to Steam Audio from here
+        SetReadiness(SystemReadiness::Ready);
+    }
+
+    void TuSteamAudioSystemComponent::SetReadiness(SystemReadiness readiness)
+    {
+        m_readiness.store(readiness, AZStd::memory_order_release);
+        TuSteamAudioNotificationBus::Broadcast(&TuSteamAudioNotifications::OnReadinessChanged, readiness);
+    }
+
+    void TuSteamAudioSystemComponent::ReleasePhonon()
+    {
+        AbandonHrtfLoad();
+        UnregisterHrtfClient(&m_ambisonicsBus);
+        m_ambisonicsBus.Release();
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_hrtfClientsMutex);
+            AZ_Warning("TuSteamAudio", m_hrtfClients.empty(), "%zu HRTF clients still registered on deactivate", m_hrtfClients.size());
+            m_hrtfClients.clear();
+        }
+
+        // Whatever the stages got to, a failed one leaves the rest null
+        if (m_simulator)
+        {
+            iplSimulatorRelease(&m_simulator);
+            m_simulator = nullptr;
+        }
+
+        if (m_scene)
+        {
+            iplSceneRelease(&m_scene);
+            m_scene = nullptr;
+        }
+
+        if (m_hrtf)
+        {
+            iplHRTFRelease(&m_hrtf);
+            m_hrtf = nullptr;
+        }
+
+        if (m_context)
+        {
+            iplContextRelease(&m_context);
+            m_context = nullptr;
+        }
     }
 
     void TuSteamAudioSystemComponent::Deactivate()
     {
         Sune::PlayerEffectFactoryBus::MultiHandler::BusDisconnect();
         AZ::TickBus::Handler::BusDisconnect();
+
+        // Stages still running finish first, they write straight into the members released below
+        if (m_initJobStarted)
+        {
+            m_initCompletion.StartAndWaitForCompletion();
+            m_initCompletion.Reset(true);
+            m_initJobStarted = false;
+        }
+        const bool wasReady = m_readiness.load(AZStd::memory_order_acquire) == SystemReadiness::Ready;
+
+        // Batched sources hold the mixer by raw pointer, they let go of it on this broadcast
+        SetReadiness(SystemReadiness::Uninitialized);
+
+        if (m_spatialMixer)
+        {
+            if (auto labContext = Sune::SuneInterface::Get()->GetLabContext())
+            {
+                labContext->disconnect(labContext->destinationNode(), m_spatialMixer);
+            }
+            m_spatialMixer = nullptr;
+        }
+
+        if (m_reflectionMixer)
+        {
+            if (auto labContext = Sune::SuneInterface::Get()->GetLabContext())
+            {
+                labContext->disconnect(labContext->destinationNode(), m_reflectionMixer);
+            }
+            m_reflectionMixer = nullptr;
+        }
+
+        // Pooled nodes hold Phonon objects and are registered HRTF clients, they go before the globals do
+        m_spatializerPool.Clear();
+
         TuSteamAudioRequestBus::Handler::BusDisconnect();
 
-        iplSimulatorRelease(&m_simulator);
-        m_simulator = nullptr;
+        if (wasReady)
+        {
+            m_probeStreamer.Deactivate();
+            m_sceneBuilder.Deactivate();
+            m_simulation.Stop();
+        }
+        // A restarted simulation needs the listener again even if it hasn't moved
+        m_simulatedListenerGeneration = 0;
 
-        iplHRTFRelease(&m_hrtf);
-        m_hrtf = nullptr;
+        ReleasePhonon();
 
-        iplContextRelease(&m_context);
-        m_context = nullptr;
+        [[maybe_unused]] const bool released = allocator.Release();
+        AZ_Warning("TuSteamAudio", released, "Steam Audio still holds memory after its context was released, keeping the pools");
     }
 
-    void TuSteamAudioSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    void TuSteamAudioSystemComponent::SetHrtf(const AZStd::string& path)
     {
-        iplSimulatorCommit(m_simulator);
-        //get labsound ctx
-        auto labContext = Sune::SuneInterface::Get()->GetLabContext();
-        if (!labContext)
+        if (!IsReady())
         {
+            AZ_Warning("TuSteamAudio", false, "Steam Audio isn't ready, HRTF '%s' not loaded", path.c_str());
             return;
         }
 
-        auto listener = labContext->listener();
-        if (!listener)
+        // Only the newest request is applied, one still loading is dropped
+        AbandonHrtfLoad();
+        m_hrtfLoad = AZStd::make_shared<HrtfLoad>();
+
+        // The job keeps the load and context alive, Deactivate may happen before it runs
+        AZ::Job* job = AZ::CreateJobFunction([load = m_hrtfLoad, context = iplContextRetain(m_context), audioSettings = m_audioSettings, path]() mutable
+        {
+            AZ_PROFILE_SCOPE(Audio, "TuSteamAudio::LoadHrtf");
+            IPLHRTF hrtf = CreateHrtf(context, audioSettings, path);
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(load->m_mutex);
+                if (!load->m_abandoned)
+                {
+                    load->m_hrtf = hrtf;
+                    hrtf = nullptr;
+                }
+                load->m_done = true;
+            }
+
+            if (hrtf)
+            {
+                iplHRTFRelease(&hrtf);
+            }
+            iplContextRelease(&context);
+        }, true);
+        job->Start();
+    }
+
+    void TuSteamAudioSystemComponent::AbandonHrtfLoad()
+    {
+        if (!m_hrtfLoad)
         {
             return;
         }
 
-        IPLVector3 listenerPos = { listener->positionX()->value(), listener->positionY()->value(), listener->positionZ()->value() };
-        IPLVector3 listenerForward = { listener->forwardX()->value(), listener->forwardY()->value(), listener->forwardZ()->value() };
-        IPLVector3 listenerUp = { listener->upX()->value(), listener->upY()->value(), listener->upZ()->value() };
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_hrtfLoad->m_mutex);
+            m_hrtfLoad->m_abandoned = true;
+            if (m_hrtfLoad->m_hrtf)
+            {
+                iplHRTFRelease(&m_hrtfLoad->m_hrtf);
+                m_hrtfLoad->m_hrtf = nullptr;
+            }
+        }
+        m_hrtfLoad = nullptr;
+    }
+
+    void TuSteamAudioSystemComponent::RegisterHrtfClient(HrtfClient* client)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_hrtfClientsMutex);
+        if (AZStd::find(m_hrtfClients.begin(), m_hrtfClients.end(), client) == m_hrtfClients.end())
+        {
+            m_hrtfClients.push_back(client);
+        }
+    }
 
-        // Compute right vector as cross product of ahead and up (left-handed coordinate system)
-        IPLVector3 listenerRight;
-        listenerRight.x = listenerForward.y * listenerUp.z - listenerForward.z * listenerUp.y;
-        listenerRight.y = listenerForward.z * listenerUp.x - listenerForward.x * listenerUp.z;
-        listenerRight.z = listenerForward.x * listenerUp.y - listenerForward.y * listenerUp.x;
+    void TuSteamAudioSystemComponent::UnregisterHrtfClient(HrtfClient* client)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_hrtfClientsMutex);
+        m_hrtfClients.erase(AZStd::remove(m_hrtfClients.begin(), m_hrtfClients.end(), client), m_hrtfClients.end());
+    }
 
-        IPLCoordinateSpace3 listenerCoords = {};
-        listenerCoords.right = listenerRight;
-        listenerCoords.up = listenerUp;
-        listenerCoords.ahead = listenerForward;
-        listenerCoords.origin = listenerPos;
+    void TuSteamAudioSystemComponent::UpdateHrtfClients()
+    {
+        if (m_hrtfLoad)
+        {
+            IPLHRTF hrtf = nullptr;
+            bool done = false;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_hrtfLoad->m_mutex);
+                done = m_hrtfLoad->m_done;
+                hrtf = m_hrtfLoad->m_hrtf;
+                m_hrtfLoad->m_hrtf = nullptr;
+            }
+
+            if (done)
+            {
+                m_hrtfLoad = nullptr;
+            }
+
+            // Clients hold their own references, the old HRTF goes once the last of them has faded away from it
+            if (hrtf)
+            {
+                iplHRTFRelease(&m_hrtf);
+                m_hrtf = hrtf;
+            }
+        }
 
-        IPLSimulationSharedInputs shared_inputs = {};
-        shared_inputs.listener = listenerCoords;
-        shared_inputs.numRays = 4096;
-        shared_inputs.numBounces = 16;
-        shared_inputs.duration = 2.0f;
-        shared_inputs.order = 1;
-        shared_inputs.irradianceMinDistance = 1.0f;
+        // Every tick, so clients also collect what their render thread retired and catch up on an offer they couldn't make
+        AZStd::lock_guard<AZStd::mutex> lock(m_hrtfClientsMutex);
+        for (HrtfClient* client : m_hrtfClients)
+        {
+            client->UpdateHrtf(m_hrtf);
+        }
+    }
 
-        /*iplSimulatorSetScene(m_simulator, m_scene);
-        iplSimulatorSetSharedInputs(m_simulator, IPL_SIMULATIONFLAGS_REFLECTIONS, &shared_inputs);
-        iplSimulatorRunReflections(m_simulator);*/
+    double TuSteamAudioSystemComponent::GetInitStageTime(InitStage stage)
+    {
+        // The job is still writing them
+        if (m_initJobStarted || stage >= InitStage::Count)
+        {
+            return 0.0;
+        }
+        return m_stageTimes[static_cast<size_t>(stage)];
+    }
+
+    PhononAllocationStats TuSteamAudioSystemComponent::GetPhononAllocationStats(PhononAllocationCategory category)
+    {
+        return allocator.GetStats(category);
+    }
+
+    void TuSteamAudioSystemComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        if (m_initJobStarted && m_initJobDone.load(AZStd::memory_order_acquire))
+        {
+            FinishInitialization();
+        }
+
+        if (!IsReady())
+        {
+            return;
+        }
+
+        if (m_spatialMixer)
+        {
+            m_spatialMixer->CollectRetiredSources();
+        }
+        m_spatializerPool.Update();
+        UpdateHrtfClients();
+
+        m_sceneBuilder.FlushPending();
+
+        // Whatever the render thread captured last, nothing to do before the first quantum
+        ListenerState listener;
+        if (!m_listenerCache.Read(listener))
+        {
+            return;
+        }
+
+        if (listener.m_generation != m_simulatedListenerGeneration)
+        {
+            // Reflections run on their own thread, this only hands over the latest listener
+            m_simulation.SetListener(listener.m_coords);
+            m_simulatedListenerGeneration = listener.m_generation;
+        }
+
+        // Probe regions follow the listener, everything streamed this frame lands in a single commit
+        m_probeStreamer.Update(listener.m_coords.origin);
+        m_simulation.RequestCommit();
+    }
+
+    void TuSteamAudioSystemComponent::SetSpatialRenderMode(SpatialRenderMode mode)
+    {
+        // Until Ready the bus may still be in the making, FinishInitialization checks the mode again
+        if (mode == SpatialRenderMode::Ambisonics && IsReady() && !m_ambisonicsBus.IsValid())
+        {
+            mode = SpatialRenderMode::Binaural;
+        }
+        m_renderMode.store(mode, AZStd::memory_order_relaxed);
     }
 
     Sune::IPlayerAudioEffect* TuSteamAudioSystemComponent::CreateEffect(AZ::Crc32 id)
@@ -240,6 +854,11 @@ namespace TuSteamAudio
             return aznew SteamAudioHrtf();
         }
 
+        if (id == SteamAudioSpatialSource::RegisterName)
+        {
+            return aznew SteamAudioSpatialSource();
+        }
+
         return nullptr;
     }
 } // namespace TuSteamAudio
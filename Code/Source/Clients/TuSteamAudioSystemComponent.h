@@ -8,9 +8,25 @@
 
 #include <AzCore/Component/Component.h>
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include <TuSteamAudio/TuSteamAudioBus.h>
 
 #include "phonon.h"
+#include "Effects/AmbisonicsBus.h"
+#include "Effects/ListenerCache.h"
+#include "Effects/AudibilityManager.h"
+#include "Effects/QualityController.h"
+#include "Effects/SpatializerPool.h"
+#include "Scene/AcousticSceneBuilder.h"
+#include "Scene/ProbeStreamer.h"
+#include "Simulation/SimulationManager.h"
+
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 namespace TuSteamAudio
 {
@@ -36,14 +52,25 @@ namespace TuSteamAudio
     protected:
         ////////////////////////////////////////////////////////////////////////
         // TuSteamAudioRequestBus interface implementation
+        SystemReadiness GetReadiness() override
+        {
+            return m_readiness.load(AZStd::memory_order_acquire);
+        }
+
+        double GetInitStageTime(InitStage stage) override;
+
         IPLHRTF GetHrtf() override
         {
-            return m_hrtf;
+            return IsReady() ? m_hrtf : nullptr;
         }
 
+        void SetHrtf(const AZStd::string& path) override;
+        void RegisterHrtfClient(HrtfClient* client) override;
+        void UnregisterHrtfClient(HrtfClient* client) override;
+
         IPLContext GetContext() override
         {
-            return m_context;
+            return IsReady() ? m_context : nullptr;
         }
 
         IPLAudioSettings GetAudioSettings() override
@@ -53,12 +80,76 @@ namespace TuSteamAudio
 
         IPLScene GetRootScene() override
         {
-            return m_scene;
+            return IsReady() ? m_scene : nullptr;
         }
 
         IPLSimulator GetSimulator() override
         {
-            return m_simulator;
+            return IsReady() ? m_simulator : nullptr;
+        }
+
+        IPLSimulationSettings GetSimulationSettings() override
+        {
+            return m_simulationSettings;
+        }
+
+        SimulationManager* GetSimulationManager() override
+        {
+            return &m_simulation;
+        }
+
+        SteamAudioSpatialMixerNode* GetSpatialMixer() override
+        {
+            return m_spatialMixer.get();
+        }
+
+        std::shared_ptr<SteamAudioReflectionMixerNode> GetReflectionMixer() override
+        {
+            return m_reflectionMixer;
+        }
+
+        AmbisonicsBus* GetAmbisonicsBus() override
+        {
+            return IsReady() && m_ambisonicsBus.IsValid() ? &m_ambisonicsBus : nullptr;
+        }
+
+        ListenerCache* GetListenerCache() override
+        {
+            return &m_listenerCache;
+        }
+
+        AudibilityManager* GetAudibilityManager() override
+        {
+            return &m_audibility;
+        }
+
+        QualityController* GetQualityController() override
+        {
+            return &m_quality;
+        }
+
+        SpatializerPool* GetSpatializerPool() override
+        {
+            return IsReady() ? &m_spatializerPool : nullptr;
+        }
+
+        SpatializerPoolStats GetSpatializerPoolStats() override
+        {
+            return m_spatializerPool.GetStats();
+        }
+
+        PhononAllocationStats GetPhononAllocationStats(PhononAllocationCategory category) override;
+
+        SpatialRenderMode GetSpatialRenderMode() override
+        {
+            return m_renderMode.load(AZStd::memory_order_relaxed);
+        }
+
+        void SetSpatialRenderMode(SpatialRenderMode mode) override;
+
+        void RebuildAcousticScene() override
+        {
+            m_sceneBuilder.Rebuild();
         }
 
         ////////////////////////////////////////////////////////////////////////
@@ -82,12 +173,70 @@ namespace TuSteamAudio
         Sune::IPlayerAudioEffect* CreateEffect(AZ::Crc32 id) override;
 
     private:
-        IPLContext m_context;
-        IPLAudioSettings m_audioSettings;
-        IPLHRTF m_hrtf;
+        bool IsReady() const { return m_readiness.load(AZStd::memory_order_acquire) == SystemReadiness::Ready; }
+        //! Init job, creates the Phonon objects in stage order. Returns the stage that failed, Count if none did.
+        InitStage RunInitStages();
+        //! Main thread, once the init job is done. Starts what needs the game or LabSound and broadcasts the outcome.
+        void FinishInitialization();
+        void SetReadiness(SystemReadiness readiness);
+        //! Releases whatever the stages created, also after a failed one.
+        void ReleasePhonon();
+
+        //! Filled in by the job loading an HRTF for SetHrtf, collected on tick.
+        struct HrtfLoad
+        {
+            AZStd::mutex m_mutex;
+            IPLHRTF m_hrtf = nullptr;
+            bool m_done = false;
+            //! Set when a newer SetHrtf or Deactivate makes the result unwanted, the job then releases it
+            bool m_abandoned = false;
+        };
+
+        void AbandonHrtfLoad();
+        //! Takes a finished load as the current HRTF and moves every client onto it.
+        void UpdateHrtfClients();
+
+        //Initialization, the job writes the Phonon members and m_stageTimes until m_initJobDone
+        AZStd::atomic<SystemReadiness> m_readiness{ SystemReadiness::Uninitialized };
+        AZStd::atomic_bool m_initJobDone{ false };
+        AZ::JobCompletion m_initCompletion;
+        bool m_initJobStarted = false;
+        InitStage m_failedStage = InitStage::Count;
+        AZStd::array<double, static_cast<size_t>(InitStage::Count)> m_stageTimes = {};
+        AZStd::chrono::steady_clock::time_point m_activateTime;
+        //Read on the main thread for the job
+        AZStd::string m_initHrtfPath;
+        int m_initAmbisonicsOrder = 2;
+        DirectSimulationSettings m_directSettings;
+        ReflectionSimulationSettings m_reflectionSettings;
+
+        IPLContext m_context = nullptr;
+        IPLAudioSettings m_audioSettings = {};
+        IPLHRTF m_hrtf = nullptr;
+        AZStd::shared_ptr<HrtfLoad> m_hrtfLoad;
+        AZStd::mutex m_hrtfClientsMutex;
+        AZStd::vector<HrtfClient*> m_hrtfClients;
+        //! Shared ambisonic bus + binaural decoder used by SpatialRenderMode::Ambisonics
+        AmbisonicsBus m_ambisonicsBus;
+        AZStd::atomic<SpatialRenderMode> m_renderMode{ SpatialRenderMode::Binaural };
+        ListenerCache m_listenerCache;
+        AudibilityManager m_audibility;
+        QualityController m_quality;
+        //! Prewarmed once Ready, emptied before the Phonon globals are released
+        SpatializerPool m_spatializerPool;
+        //! Generation of the listener last handed to the simulation
+        AZ::u64 m_simulatedListenerGeneration = 0;
 
         IPLScene m_scene = nullptr;
         IPLSimulator m_simulator = nullptr;
+        IPLSimulationSettings m_simulationSettings = {};
+        SimulationManager m_simulation;
+        AcousticSceneBuilder m_sceneBuilder;
+        ProbeStreamer m_probeStreamer;
+
+        std::shared_ptr<SteamAudioSpatialMixerNode> m_spatialMixer;
+        //! Null unless reflections run with the shared mixer
+        std::shared_ptr<SteamAudioReflectionMixerNode> m_reflectionMixer;
     };
 
 } // namespace TuSteamAudio
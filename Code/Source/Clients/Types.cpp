@@ -5,6 +5,7 @@
  * For complete copyright and license terms please see the LICENSE at the root of this distribution.
  */
 #include <TuSteamAudio/Types.h>
+#include <TuSteamAudio/AttenuationTable.h>
 #include <AzCore/Serialization/SerializeContext.h>
 
 using namespace TuSteamAudio;
@@ -20,6 +21,10 @@ void Attenuation::TuAttenuation::Reflect(AZ::ReflectContext* context)
         ->Value("InverseDistance", DistanceModel::InverseDistance)
         ->Value("TuAttenuation", DistanceModel::TuAttenuation);
 
+    sc->Enum<SpatialRenderMode>()
+        ->Value("Binaural", SpatialRenderMode::Binaural)
+        ->Value("Ambisonics", SpatialRenderMode::Ambisonics);
+
     sc->Enum<Attenuation::Shape>()
         ->Value("Linear", Attenuation::Shape::Sphere);
 
@@ -54,36 +59,30 @@ float Attenuation::TuAttenuation::CalculateAttenuation(float distance) {
 
     float normalizedDistance = effectiveDistance / m_falloffDistance;
 
+    // Exact reference, per sample work goes through AttenuationTable instead
     float attenuation = 1.0f;
     switch (m_curveType)
     {
         case Attenuation::TuAttenuation::CurveType::Linear:
-            attenuation = 1.0f - normalizedDistance;
+            attenuation = CurveEvaluator<CurveType::Linear>::Evaluate(normalizedDistance, distance, m_innerRadius);
             break;
 
         case Attenuation::TuAttenuation::CurveType::Logarithmic:
-            // Log base 10: log10(x) = log(x) / log(10)
-            attenuation = 1.0f - (std::log(normalizedDistance * 9.0f + 1.0f) / std::log(10.0f));
+            attenuation = CurveEvaluator<CurveType::Logarithmic>::Evaluate(normalizedDistance, distance, m_innerRadius);
             break;
 
         case Attenuation::TuAttenuation::CurveType::Inverse:
-            // Inverse distance: 1/d falloff
-            attenuation = m_innerRadius / distance;
+            attenuation = CurveEvaluator<CurveType::Inverse>::Evaluate(normalizedDistance, distance, m_innerRadius);
             break;
 
         case Attenuation::TuAttenuation::CurveType::NaturalSound:
-            // Inverse square law: 1/d² (physically accurate for sound)
-        {
-            float ratio = m_innerRadius / distance;
-            attenuation = ratio * ratio;
-        }
+            attenuation = CurveEvaluator<CurveType::NaturalSound>::Evaluate(normalizedDistance, distance, m_innerRadius);
             break;
 
         case Attenuation::TuAttenuation::CurveType::LogReverse:
-            // Reverse logarithmic curve
-            attenuation = std::log((1.0f - normalizedDistance) * 9.0f + 1.0f) / std::log(10.0f);
+            attenuation = CurveEvaluator<CurveType::LogReverse>::Evaluate(normalizedDistance, distance, m_innerRadius);
             break;
     }
 
     return AZ::GetClamp(attenuation, 0.0f, 1.0f);
-}
\ No newline at end of file
+}
@@ -0,0 +1,136 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "AcousticSceneExporter.h"
+
+#include <Clients/Scene/AcousticSceneFile.h>
+#include <TuSteamAudio/TuSteamAudioBus.h>
+#include <TuSteamAudio/Utils.h>
+
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzToolsFramework/Entity/PrefabEditorEntityOwnershipInterface.h>
+#include <AzToolsFramework/Prefab/PrefabLoaderInterface.h>
+#include <AzToolsFramework/Prefab/PrefabSystemComponentInterface.h>
+
+using namespace TuSteamAudio;
+
+bool AcousticSceneExporter::Export(IPLContext context, const AcousticSceneSettings& settings, const AZ::IO::PathView& outputPath)
+{
+    IPLSceneSettings sceneSettings{};
+    sceneSettings.type = IPL_SCENETYPE_DEFAULT;
+
+    IPLScene scene = nullptr;
+    IPLerror err = iplSceneCreate(context, &sceneSettings, &scene);
+    if (err != IPL_STATUS_SUCCESS)
+    {
+        AZ_Error("AcousticSceneExporter", false, "Failed to create export scene");
+        return false;
+    }
+
+    // Same gathering and conversion as the runtime fallback, into a scene of our own
+    AcousticSceneSettings exportSettings = settings;
+    exportSettings.m_enabled = true;
+
+    AcousticSceneBuilder builder;
+    builder.Activate(context, scene, nullptr, exportSettings);
+    const AZ::u32 staticMeshCount = static_cast<AZ::u32>(builder.GetStaticMeshCount());
+    iplSceneCommit(scene);
+
+    // The bounds are what the asset processor generates reflection probes in
+    AcousticSceneFile::Header sceneInfo;
+    sceneInfo.m_staticMeshCount = staticMeshCount;
+    if (staticMeshCount > 0)
+    {
+        sceneInfo.m_boundsMin = ToIPL(builder.GetBounds().GetMin());
+        sceneInfo.m_boundsMax = ToIPL(builder.GetBounds().GetMax());
+    }
+
+    AZStd::vector<AZ::u8> data;
+    const bool serialized = staticMeshCount > 0 && AcousticSceneFile::Serialize(context, scene, sceneInfo, data);
+
+    builder.Deactivate();
+    iplSceneRelease(&scene);
+
+    if (staticMeshCount == 0)
+    {
+        AZ_Warning("AcousticSceneExporter", false, "No static geometry to export, mark acoustic geometry entities as static");
+        return false;
+    }
+
+    if (!serialized)
+    {
+        return false;
+    }
+
+    const AZ::IO::FixedMaxPath path(outputPath);
+
+    AcousticSceneFile::Header newHeader;
+    memcpy(&newHeader, data.data(), sizeof(newHeader));
+
+    AcousticSceneFile::Header existingHeader;
+    if (AcousticSceneFile::ReadHeader(path.c_str(), existingHeader) &&
+        existingHeader.m_version == newHeader.m_version &&
+        existingHeader.m_steamAudioVersion == newHeader.m_steamAudioVersion &&
+        existingHeader.m_contentHash == newHeader.m_contentHash)
+    {
+        AZ_TracePrintf("AcousticSceneExporter", "Acoustic geometry unchanged, skipped writing %s\n", path.c_str());
+        return true;
+    }
+
+    AZ::IO::SystemFile file;
+    if (!file.Open(path.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY))
+    {
+        AZ_Error("AcousticSceneExporter", false, "Failed to open %s for writing", path.c_str());
+        return false;
+    }
+
+    if (file.Write(data.data(), data.size()) != data.size())
+    {
+        AZ_Error("AcousticSceneExporter", false, "Failed to write %s", path.c_str());
+        return false;
+    }
+
+    AZ_TracePrintf("AcousticSceneExporter", "Exported %u static meshes to %s\n", staticMeshCount, path.c_str());
+    return true;
+}
+
+bool AcousticSceneExporter::ExportOpenLevel()
+{
+    auto* ownership = AZ::Interface<AzToolsFramework::PrefabEditorEntityOwnershipInterface>::Get();
+    auto* prefabSystem = AZ::Interface<AzToolsFramework::Prefab::PrefabSystemComponentInterface>::Get();
+    auto* prefabLoader = AZ::Interface<AzToolsFramework::Prefab::PrefabLoaderInterface>::Get();
+    auto* steamAudio = TuSteamAudioInterface::Get();
+    if (!ownership || !prefabSystem || !prefabLoader || !steamAudio)
+    {
+        return false;
+    }
+
+    if (!steamAudio->GetContext())
+    {
+        AZ_Warning("AcousticSceneExporter", false, "Steam Audio isn't ready yet");
+        return false;
+    }
+
+    auto levelTemplate = prefabSystem->FindTemplate(ownership->GetRootPrefabTemplateId());
+    if (!levelTemplate.has_value() || levelTemplate->get().GetFilePath().empty())
+    {
+        AZ_Warning("AcousticSceneExporter", false, "No level is open");
+        return false;
+    }
+
+    AZ::IO::Path outputPath = prefabLoader->GetFullPath(levelTemplate->get().GetFilePath());
+    outputPath.ReplaceExtension(AcousticSceneFile::SourceExtension);
+
+    return Export(steamAudio->GetContext(), ReadAcousticSceneSettings(), outputPath);
+}
+
+static void sa_ExportAcousticScene([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+{
+    AcousticSceneExporter::ExportOpenLevel();
+}
+
+AZ_CONSOLEFREE_FUNC(sa_ExportAcousticScene, AZ::ConsoleFunctorFlags::Null, "Exports the open level's static geometry to a .saacoustic file for the asset processor.");
@@ -0,0 +1,24 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <Clients/Scene/AcousticSceneBuilder.h>
+
+#include <AzCore/IO/Path/Path.h>
+
+namespace TuSteamAudio
+{
+    namespace AcousticSceneExporter
+    {
+        //! Gathers the static geometry of the loaded editor entities and writes it to outputPath as a .saacoustic source.
+        //! Leaves an existing file untouched when its content hash matches, so the asset processor doesn't rebuild it.
+        bool Export(IPLContext context, const AcousticSceneSettings& settings, const AZ::IO::PathView& outputPath);
+
+        //! Exports next to the open level's prefab, e.g. Levels/Foo/Foo.saacoustic.
+        bool ExportOpenLevel();
+    } // AcousticSceneExporter
+} // TuSteamAudio
@@ -20,15 +20,11 @@ AttenuationGraphWidget::AttenuationGraphWidget(QWidget* parent)
 
 void AttenuationGraphWidget::UpdateAttenuation(const Attenuation::TuAttenuation& settings)
 {
-    //check if we should bother to update
-    if (settings.m_innerRadius == m_attenuation.m_innerRadius &&
-        settings.m_falloffDistance == m_attenuation.m_falloffDistance &&
-        settings.m_curveType == m_attenuation.m_curveType)
+    //only repaint when the curve changed, the other settings don't affect it
+    if (!m_table.Build(settings))
     {
-        //We dont care for the other settings
         return;
     }
-    m_attenuation = settings;
 
     update();
 }
@@ -45,6 +41,8 @@ void AttenuationGraphWidget::SetListenerDistance(float distance)
 
 void AttenuationGraphWidget::paintEvent(QPaintEvent* event)
 {
+    const Attenuation::TuAttenuation& attenuation = m_table.GetSettings();
+
     QPainter p(this);
     p.setRenderHint(QPainter::Antialiasing);
 
@@ -74,12 +72,12 @@ void AttenuationGraphWidget::paintEvent(QPaintEvent* event)
     for (int i = 0; i <= numPoints; ++i)
     {
         float t = static_cast<float>(i) / numPoints;
-        float distance = m_attenuation.m_innerRadius + (m_attenuation.m_falloffDistance * t);
+        float distance = attenuation.m_innerRadius + (attenuation.m_falloffDistance * t);
 
-        float attenuation = m_attenuation.CalculateAttenuation(distance);
+        float gain = m_table.Lookup(distance);
 
         float x = graphRect.left() + (t * graphRect.width());
-        float y = graphRect.bottom() - (attenuation * graphRect.height());
+        float y = graphRect.bottom() - (gain * graphRect.height());
 
         if (i == 0)
         {
@@ -96,19 +94,19 @@ void AttenuationGraphWidget::paintEvent(QPaintEvent* event)
 
     if (m_listenerDistance > 0.0f)
     {
-        const float distanceFromInner = m_listenerDistance - m_attenuation.m_innerRadius;
+        const float distanceFromInner = m_listenerDistance - attenuation.m_innerRadius;
 
         //calculate X position on graph (normalised)
         float t = 0.0f;
-        if (m_attenuation.m_falloffDistance > 0.0f)
+        if (attenuation.m_falloffDistance > 0.0f)
         {
-            t = distanceFromInner / m_attenuation.m_falloffDistance;
+            t = distanceFromInner / attenuation.m_falloffDistance;
             t = qBound(0.0f, t, 1.0f);
         }
 
         const float lineX = graphRect.left() + (t * graphRect.width());
 
-        const float currentAttenuation = m_attenuation.CalculateAttenuation(m_listenerDistance);
+        const float currentAttenuation = m_table.Lookup(m_listenerDistance);
         const float lineY = graphRect.bottom() - (currentAttenuation * graphRect.height());
 
         p.setPen(QPen(QColor(255, 200, 50), 2, Qt::DashLine));
@@ -128,11 +126,11 @@ void AttenuationGraphWidget::paintEvent(QPaintEvent* event)
     p.drawText(graphRect.topLeft() + QPointF(5, 15), "1.0");
     p.drawText(graphRect.bottomLeft() + QPointF(5, -5), "0.0");
 
-    QString innerLabel = QString("%1m").arg(m_attenuation.m_innerRadius, 0, 'f', 0);
+    QString innerLabel = QString("%1m").arg(attenuation.m_innerRadius, 0, 'f', 0);
     p.drawText(graphRect.bottomLeft() + QPointF(5, 20), innerLabel);
 
     QString outerLabel = QString("%1m").arg(
-        m_attenuation.m_innerRadius + m_attenuation.m_falloffDistance, 0, 'f', 0);
+        attenuation.m_innerRadius + attenuation.m_falloffDistance, 0, 'f', 0);
     p.drawText(graphRect.bottomRight() + QPointF(-50, 20), outerLabel);
 }
 
@@ -9,7 +9,7 @@
 #if !defined(Q_MOC_RUN)
 #include <QWidget>
 
-#include "TuSteamAudio/Types.h"
+#include "TuSteamAudio/AttenuationTable.h"
 #endif
 
 namespace TuSteamAudio
@@ -26,7 +26,8 @@ namespace TuSteamAudio
    protected:
        void paintEvent(QPaintEvent* event) override;
    private:
-       Attenuation::TuAttenuation m_attenuation = {};
+       //Same table the renderers use, so the graph shows exactly what is heard
+       Attenuation::AttenuationTable m_table;
        float m_listenerDistance = 0.0f;
    };
 }
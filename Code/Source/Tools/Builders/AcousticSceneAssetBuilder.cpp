@@ -0,0 +1,232 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "AcousticSceneAssetBuilder.h"
+#include "ReflectionProbeBaker.h"
+
+#include <Clients/Scene/AcousticSceneFile.h>
+#include <TuSteamAudio/TuSteamAudioTypeIds.h>
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/StringFunc/StringFunc.h>
+#include <AzCore/Utils/Utils.h>
+
+namespace TuSteamAudio
+{
+    static constexpr const char* AcousticSceneJobKey = "Steam Audio Acoustic Scene";
+    static constexpr const char* ReflectionProbesJobKey = "Steam Audio Reflection Probes";
+    static constexpr AZ::u32 ReflectionProbesSubId = 1;
+
+    void AcousticSceneAssetBuilder::RegisterBuilder()
+    {
+        AssetBuilderSDK::AssetBuilderDesc builderDesc;
+        builderDesc.m_name = "Steam Audio Acoustic Scene Builder";
+        builderDesc.m_patterns.emplace_back(AssetBuilderSDK::AssetBuilderPattern(
+            AZStd::string::format("*.%s", AcousticSceneFile::SourceExtension), AssetBuilderSDK::AssetBuilderPattern::PatternType::Wildcard));
+        builderDesc.m_busId = AZ::Uuid(AcousticSceneAssetBuilderComponentTypeId);
+        // Products are rebuilt when the file format changes
+        builderDesc.m_version = AcousticSceneFile::Header::CurrentVersion;
+        builderDesc.m_createJobFunction = [this](const AssetBuilderSDK::CreateJobsRequest& request, AssetBuilderSDK::CreateJobsResponse& response)
+        {
+            CreateJobs(request, response);
+        };
+        builderDesc.m_processJobFunction = [this](const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response)
+        {
+            ProcessJob(request, response);
+        };
+
+        BusConnect(builderDesc.m_busId);
+        AssetBuilderSDK::AssetBuilderBus::Broadcast(&AssetBuilderSDK::AssetBuilderBus::Events::RegisterBuilderInformation, builderDesc);
+    }
+
+    void AcousticSceneAssetBuilder::UnregisterBuilder()
+    {
+        BusDisconnect();
+    }
+
+    void AcousticSceneAssetBuilder::CreateJobs(const AssetBuilderSDK::CreateJobsRequest& request, AssetBuilderSDK::CreateJobsResponse& response) const
+    {
+        if (m_isShuttingDown)
+        {
+            response.m_result = AssetBuilderSDK::CreateJobsResultCode::ShuttingDown;
+            return;
+        }
+
+        for (const AssetBuilderSDK::PlatformInfo& platform : request.m_enabledPlatforms)
+        {
+            AssetBuilderSDK::JobDescriptor descriptor;
+            descriptor.m_jobKey = AcousticSceneJobKey;
+            descriptor.SetPlatformIdentifier(platform.m_identifier.c_str());
+            // Scenes saved by one Steam Audio version don't load in another
+            descriptor.m_additionalFingerprintInfo = AZStd::string::format("%u", STEAMAUDIO_VERSION);
+            response.m_createJobOutputs.push_back(descriptor);
+        }
+
+        // Baking takes minutes, so it runs as its own job and the scene product isn't held up by it
+        const ProbeBakeSettings probeSettings = ReadProbeBakeSettings();
+        if (probeSettings.m_enabled)
+        {
+            for (const AssetBuilderSDK::PlatformInfo& platform : request.m_enabledPlatforms)
+            {
+                AssetBuilderSDK::JobDescriptor descriptor;
+                descriptor.m_jobKey = ReflectionProbesJobKey;
+                descriptor.SetPlatformIdentifier(platform.m_identifier.c_str());
+                descriptor.m_additionalFingerprintInfo = probeSettings.GetFingerprint();
+                response.m_createJobOutputs.push_back(descriptor);
+            }
+        }
+
+        response.m_result = AssetBuilderSDK::CreateJobsResultCode::Success;
+    }
+
+    void AcousticSceneAssetBuilder::ProcessJob(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response) const
+    {
+        response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+
+        if (m_isShuttingDown)
+        {
+            response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Cancelled;
+            return;
+        }
+
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<AZ::u8>>(request.m_fullPath);
+        if (!readResult.IsSuccess())
+        {
+            AZ_Error(AssetBuilderSDK::ErrorWindow, false, "Failed to read %s: %s", request.m_fullPath.c_str(), readResult.GetError().c_str());
+            return;
+        }
+
+        const AZStd::vector<AZ::u8>& data = readResult.GetValue();
+        if (!AcousticSceneFile::Validate(data.data(), data.size()))
+        {
+            AZ_Error(AssetBuilderSDK::ErrorWindow, false, "%s is not a valid acoustic scene, export it again from the editor", request.m_sourceFile.c_str());
+            return;
+        }
+
+        if (request.m_jobDescription.m_jobKey == ReflectionProbesJobKey)
+        {
+            ProcessProbeJob(request, data, response);
+        }
+        else
+        {
+            ProcessSceneJob(request, data, response);
+        }
+    }
+
+    void AcousticSceneAssetBuilder::ProcessSceneJob(const AssetBuilderSDK::ProcessJobRequest& request, const AZStd::vector<AZ::u8>& data,
+        AssetBuilderSDK::ProcessJobResponse& response) const
+    {
+        AZ::IO::Path productPath = AZ::IO::Path(request.m_tempDirPath) / AZ::IO::PathView(request.m_sourceFile).Filename();
+        productPath.ReplaceExtension(AcousticSceneFile::ProductExtension);
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(productPath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY) ||
+            file.Write(data.data(), data.size()) != data.size())
+        {
+            AZ_Error(AssetBuilderSDK::ErrorWindow, false, "Failed to write %s", productPath.c_str());
+            return;
+        }
+        file.Close();
+
+        AssetBuilderSDK::JobProduct product(productPath.String(), AZ::Data::AssetType(AcousticSceneAssetTypeId), 0);
+        product.m_dependenciesHandled = true;
+        response.m_outputProducts.push_back(AZStd::move(product));
+        response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
+    }
+
+    void AcousticSceneAssetBuilder::ProcessProbeJob(const AssetBuilderSDK::ProcessJobRequest& request, const AZStd::vector<AZ::u8>& data,
+        AssetBuilderSDK::ProcessJobResponse& response) const
+    {
+        // Asset builders run without the audio system, the bake gets a context of its own
+        IPLContextSettings contextSettings{};
+        contextSettings.version = STEAMAUDIO_VERSION;
+
+        IPLContext context = nullptr;
+        IPLerror err = iplContextCreate(&contextSettings, &context);
+        if (err != IPL_STATUS_SUCCESS)
+        {
+            AZ_Error(AssetBuilderSDK::ErrorWindow, false, "Failed to create Phonon context");
+            return;
+        }
+
+        AcousticSceneFile::Header sceneHeader;
+        memcpy(&sceneHeader, data.data(), sizeof(sceneHeader));
+
+        IPLScene scene = AcousticSceneFile::Load(context, data.data(), data.size());
+        if (!scene)
+        {
+            iplContextRelease(&context);
+            return;
+        }
+
+        AssetBuilderSDK::JobCancelListener cancelListener(request.m_jobId);
+        auto isCancelled = [this, &cancelListener]()
+        {
+            return m_isShuttingDown || cancelListener.IsCancelled();
+        };
+
+        AZStd::vector<AZ::u8> probeData;
+        const bool baked = ReflectionProbeBaker::Bake(context, scene, sceneHeader, ReadProbeBakeSettings(), isCancelled, probeData);
+
+        iplSceneRelease(&scene);
+        iplContextRelease(&context);
+
+        if (isCancelled())
+        {
+            response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Cancelled;
+            return;
+        }
+
+        if (!baked)
+        {
+            AZ_Error(AssetBuilderSDK::ErrorWindow, false, "Failed to bake reflection probes for %s", request.m_sourceFile.c_str());
+            return;
+        }
+
+        AZ::IO::Path productPath = AZ::IO::Path(request.m_tempDirPath) / AZ::IO::PathView(request.m_sourceFile).Filename();
+        productPath.ReplaceExtension(AcousticProbeFile::ProductExtension);
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(productPath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY) ||
+            file.Write(probeData.data(), probeData.size()) != probeData.size())
+        {
+            AZ_Error(AssetBuilderSDK::ErrorWindow, false, "Failed to write %s", productPath.c_str());
+            return;
+        }
+        file.Close();
+
+        AssetBuilderSDK::JobProduct product(productPath.String(), AZ::Data::AssetType(AcousticProbesAssetTypeId), ReflectionProbesSubId);
+        product.m_dependenciesHandled = true;
+        response.m_outputProducts.push_back(AZStd::move(product));
+        response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
+    }
+
+    AZ_COMPONENT_IMPL(AcousticSceneAssetBuilderComponent, "AcousticSceneAssetBuilderComponent",
+        AcousticSceneAssetBuilderComponentTypeId);
+
+    void AcousticSceneAssetBuilderComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<AcousticSceneAssetBuilderComponent, AZ::Component>()
+                ->Version(0)
+                ->Attribute(AZ::Edit::Attributes::SystemComponentTags, AZStd::vector<AZ::Crc32>({ AssetBuilderSDK::ComponentTags::AssetBuilder }));
+        }
+    }
+
+    void AcousticSceneAssetBuilderComponent::Activate()
+    {
+        m_builder.RegisterBuilder();
+    }
+
+    void AcousticSceneAssetBuilderComponent::Deactivate()
+    {
+        m_builder.UnregisterBuilder();
+    }
+} // namespace TuSteamAudio
@@ -0,0 +1,55 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AssetBuilderSDK/AssetBuilderBusses.h>
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+#include <AzCore/Component/Component.h>
+
+namespace TuSteamAudio
+{
+    //! Turns the editor's .saacoustic exports into .saacousticscene products next to the level's spawnable.
+    //! The source is validated so a corrupt or stale export never reaches the runtime.
+    //! A second job bakes reflection probes from the same source into a .saprobes product.
+    class AcousticSceneAssetBuilder
+        : public AssetBuilderSDK::AssetBuilderCommandBus::Handler
+    {
+    public:
+        void RegisterBuilder();
+        void UnregisterBuilder();
+
+        void CreateJobs(const AssetBuilderSDK::CreateJobsRequest& request, AssetBuilderSDK::CreateJobsResponse& response) const;
+        void ProcessJob(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response) const;
+
+        // AssetBuilderCommandBus
+        void ShutDown() override { m_isShuttingDown = true; }
+
+    private:
+        void ProcessSceneJob(const AssetBuilderSDK::ProcessJobRequest& request, const AZStd::vector<AZ::u8>& data,
+            AssetBuilderSDK::ProcessJobResponse& response) const;
+        void ProcessProbeJob(const AssetBuilderSDK::ProcessJobRequest& request, const AZStd::vector<AZ::u8>& data,
+            AssetBuilderSDK::ProcessJobResponse& response) const;
+
+        bool m_isShuttingDown = false;
+    };
+
+    //! Only active inside asset builder processes.
+    class AcousticSceneAssetBuilderComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT_DECL(AcousticSceneAssetBuilderComponent);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        void Activate() override;
+        void Deactivate() override;
+
+    private:
+        AcousticSceneAssetBuilder m_builder;
+    };
+} // TuSteamAudio
@@ -0,0 +1,306 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "HrtfAssetBuilder.h"
+
+#include <Clients/Hrtf/HrtfFile.h>
+#include <TuSteamAudio/TuSteamAudioTypeIds.h>
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/MathUtils.h>
+#include <AzCore/Serialization/EditContextConstants.inl>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Utils/Utils.h>
+
+#include <cmath>
+
+namespace TuSteamAudio
+{
+    static constexpr const char* HrtfJobKey = "Steam Audio HRTF";
+    static constexpr const char* TargetSampleRatesPath = "/TuSteamAudio/Hrtf/TargetSampleRates";
+
+    // Long enough for any measured HRIR, the impulse and its tail fit in two frames
+    static constexpr int MeasureFrameSize = 1024;
+    static constexpr int MeasureElevations = 9;
+    static constexpr int MeasureAzimuths = 24;
+
+    AZStd::vector<AZ::u32> ReadHrtfTargetSampleRates()
+    {
+        AZStd::vector<AZ::u32> rates;
+        if (auto* registry = AZ::SettingsRegistry::Get())
+        {
+            AZ::s64 rate = 0;
+            for (int i = 0; registry->Get(rate, AZStd::string::format("%s/%d", TargetSampleRatesPath, i)); ++i)
+            {
+                if (rate > 0)
+                {
+                    rates.push_back(static_cast<AZ::u32>(rate));
+                }
+            }
+        }
+
+        if (rates.empty())
+        {
+            rates = { 44100, 48000 };
+        }
+        return rates;
+    }
+
+    // Energy of both ears' impulse responses averaged over the sphere, rings weighted by the area they cover
+    static bool MeasureEnergy(IPLContext context, IPLAudioSettings audioSettings, IPLHRTF hrtf, double& outEnergy)
+    {
+        audioSettings.frameSize = MeasureFrameSize;
+
+        IPLBinauralEffectSettings effectSettings{};
+        effectSettings.hrtf = hrtf;
+
+        IPLBinauralEffect effect = nullptr;
+        if (iplBinauralEffectCreate(context, &audioSettings, &effectSettings, &effect) != IPL_STATUS_SUCCESS)
+        {
+            return false;
+        }
+
+        AZStd::vector<float> input(MeasureFrameSize, 0.0f);
+        AZStd::vector<float> left(MeasureFrameSize, 0.0f);
+        AZStd::vector<float> right(MeasureFrameSize, 0.0f);
+        float* inputChannels[] = { input.data() };
+        float* outputChannels[] = { left.data(), right.data() };
+
+        IPLAudioBuffer inBuffer{};
+        inBuffer.numChannels = 1;
+        inBuffer.numSamples = MeasureFrameSize;
+        inBuffer.data = inputChannels;
+
+        IPLAudioBuffer outBuffer{};
+        outBuffer.numChannels = 2;
+        outBuffer.numSamples = MeasureFrameSize;
+        outBuffer.data = outputChannels;
+
+        double energy = 0.0;
+        double totalWeight = 0.0;
+        for (int e = 0; e < MeasureElevations; ++e)
+        {
+            const float elevation = AZ::Constants::Pi * ((e + 0.5f) / MeasureElevations - 0.5f);
+            const float weight = std::cos(elevation);
+            for (int a = 0; a < MeasureAzimuths; ++a)
+            {
+                const float azimuth = AZ::Constants::TwoPi * a / MeasureAzimuths;
+
+                IPLBinauralEffectParams params{};
+                params.direction = IPLVector3{ weight * std::sin(azimuth), std::sin(elevation), -weight * std::cos(azimuth) };
+                params.interpolation = IPL_HRTFINTERPOLATION_NEAREST;
+                params.spatialBlend = 1.0f;
+                params.hrtf = hrtf;
+
+                iplBinauralEffectReset(effect);
+                double directionEnergy = 0.0;
+                for (int frame = 0; frame < 2; ++frame)
+                {
+                    input[0] = frame == 0 ? 1.0f : 0.0f;
+                    iplBinauralEffectApply(effect, &params, &inBuffer, &outBuffer);
+                    for (int i = 0; i < MeasureFrameSize; ++i)
+                    {
+                        directionEnergy += static_cast<double>(left[i]) * left[i] + static_cast<double>(right[i]) * right[i];
+                    }
+                }
+
+                energy += weight * directionEnergy;
+                totalWeight += weight;
+            }
+        }
+
+        iplBinauralEffectRelease(&effect);
+        outEnergy = energy / totalWeight;
+        return true;
+    }
+
+    // Gain matching the SOFA HRTF's loudness to the default one at samplingRate, false if Steam Audio can't load it
+    static bool MeasureRate(IPLContext context, const AZStd::vector<AZ::u8>& sofa, AZ::u32 samplingRate, HrtfFile::Rate& outRate)
+    {
+        IPLAudioSettings audioSettings{};
+        audioSettings.samplingRate = static_cast<IPLint32>(samplingRate);
+        audioSettings.frameSize = MeasureFrameSize;
+
+        IPLHRTFSettings defaultSettings{};
+        defaultSettings.type = IPL_HRTFTYPE_DEFAULT;
+        defaultSettings.volume = 1.0f;
+
+        IPLHRTFSettings sofaSettings{};
+        sofaSettings.type = IPL_HRTFTYPE_SOFA;
+        sofaSettings.sofaData = sofa.data();
+        sofaSettings.sofaDataSize = static_cast<IPLint32>(sofa.size());
+        sofaSettings.volume = 1.0f;
+        sofaSettings.normType = IPL_HRTFNORMTYPE_NONE;
+
+        IPLHRTF defaultHrtf = nullptr;
+        IPLHRTF sofaHrtf = nullptr;
+        double defaultEnergy = 0.0;
+        double sofaEnergy = 0.0;
+        const bool measured = iplHRTFCreate(context, &audioSettings, &defaultSettings, &defaultHrtf) == IPL_STATUS_SUCCESS &&
+            iplHRTFCreate(context, &audioSettings, &sofaSettings, &sofaHrtf) == IPL_STATUS_SUCCESS &&
+            MeasureEnergy(context, audioSettings, defaultHrtf, defaultEnergy) &&
+            MeasureEnergy(context, audioSettings, sofaHrtf, sofaEnergy) &&
+            sofaEnergy > 0.0;
+
+        iplHRTFRelease(&sofaHrtf);
+        iplHRTFRelease(&defaultHrtf);
+
+        if (measured)
+        {
+            outRate.m_samplingRate = samplingRate;
+            outRate.m_volume = static_cast<float>(std::sqrt(defaultEnergy / sofaEnergy));
+        }
+        return measured;
+    }
+
+    void HrtfAssetBuilder::RegisterBuilder()
+    {
+        AssetBuilderSDK::AssetBuilderDesc builderDesc;
+        builderDesc.m_name = "Steam Audio HRTF Builder";
+        builderDesc.m_patterns.emplace_back(AssetBuilderSDK::AssetBuilderPattern(
+            AZStd::string::format("*.%s", HrtfFile::SourceExtension), AssetBuilderSDK::AssetBuilderPattern::PatternType::Wildcard));
+        builderDesc.m_busId = AZ::Uuid(HrtfAssetBuilderComponentTypeId);
+        // Products are rebuilt when the file format changes
+        builderDesc.m_version = HrtfFile::Header::CurrentVersion;
+        builderDesc.m_createJobFunction = [this](const AssetBuilderSDK::CreateJobsRequest& request, AssetBuilderSDK::CreateJobsResponse& response)
+        {
+            CreateJobs(request, response);
+        };
+        builderDesc.m_processJobFunction = [this](const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response)
+        {
+            ProcessJob(request, response);
+        };
+
+        BusConnect(builderDesc.m_busId);
+        AssetBuilderSDK::AssetBuilderBus::Broadcast(&AssetBuilderSDK::AssetBuilderBus::Events::RegisterBuilderInformation, builderDesc);
+    }
+
+    void HrtfAssetBuilder::UnregisterBuilder()
+    {
+        BusDisconnect();
+    }
+
+    void HrtfAssetBuilder::CreateJobs(const AssetBuilderSDK::CreateJobsRequest& request, AssetBuilderSDK::CreateJobsResponse& response) const
+    {
+        if (m_isShuttingDown)
+        {
+            response.m_result = AssetBuilderSDK::CreateJobsResultCode::ShuttingDown;
+            return;
+        }
+
+        // Steam Audio's resampler and default HRTF both feed into the measured gains
+        AZStd::string fingerprint = AZStd::string::format("%u", STEAMAUDIO_VERSION);
+        for (AZ::u32 rate : ReadHrtfTargetSampleRates())
+        {
+            fingerprint += AZStd::string::format("|%u", rate);
+        }
+
+        for (const AssetBuilderSDK::PlatformInfo& platform : request.m_enabledPlatforms)
+        {
+            AssetBuilderSDK::JobDescriptor descriptor;
+            descriptor.m_jobKey = HrtfJobKey;
+            descriptor.SetPlatformIdentifier(platform.m_identifier.c_str());
+            descriptor.m_additionalFingerprintInfo = fingerprint;
+            response.m_createJobOutputs.push_back(descriptor);
+        }
+
+        response.m_result = AssetBuilderSDK::CreateJobsResultCode::Success;
+    }
+
+    void HrtfAssetBuilder::ProcessJob(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response) const
+    {
+        response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+
+        if (m_isShuttingDown)
+        {
+            response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Cancelled;
+            return;
+        }
+
+        auto readResult = AZ::Utils::ReadFile<AZStd::vector<AZ::u8>>(request.m_fullPath);
+        if (!readResult.IsSuccess())
+        {
+            AZ_Error(AssetBuilderSDK::ErrorWindow, false, "Failed to read %s: %s", request.m_fullPath.c_str(), readResult.GetError().c_str());
+            return;
+        }
+        const AZStd::vector<AZ::u8>& sofa = readResult.GetValue();
+
+        // Asset builders run without the audio system, the measurement gets a context of its own
+        IPLContextSettings contextSettings{};
+        contextSettings.version = STEAMAUDIO_VERSION;
+
+        IPLContext context = nullptr;
+        IPLerror err = iplContextCreate(&contextSettings, &context);
+        if (err != IPL_STATUS_SUCCESS)
+        {
+            AZ_Error(AssetBuilderSDK::ErrorWindow, false, "Failed to create Phonon context");
+            return;
+        }
+
+        AZStd::vector<HrtfFile::Rate> rates;
+        for (AZ::u32 samplingRate : ReadHrtfTargetSampleRates())
+        {
+            HrtfFile::Rate rate;
+            if (!MeasureRate(context, sofa, samplingRate, rate))
+            {
+                AZ_Error(AssetBuilderSDK::ErrorWindow, false, "Steam Audio can't load %s at %u Hz, is it a valid SOFA file?",
+                    request.m_sourceFile.c_str(), samplingRate);
+                iplContextRelease(&context);
+                return;
+            }
+            AZ_TracePrintf(AssetBuilderSDK::InfoWindow, "%u Hz: %.2f dB to match the default HRTF", samplingRate, 20.0f * std::log10(rate.m_volume));
+            rates.push_back(rate);
+        }
+        iplContextRelease(&context);
+
+        AZStd::vector<AZ::u8> product;
+        if (!HrtfFile::Serialize(rates, sofa.data(), sofa.size(), product))
+        {
+            return;
+        }
+
+        AZ::IO::Path productPath = AZ::IO::Path(request.m_tempDirPath) / AZ::IO::PathView(request.m_sourceFile).Filename();
+        productPath.ReplaceExtension(HrtfFile::ProductExtension);
+
+        AZ::IO::SystemFile file;
+        if (!file.Open(productPath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY) ||
+            file.Write(product.data(), product.size()) != product.size())
+        {
+            AZ_Error(AssetBuilderSDK::ErrorWindow, false, "Failed to write %s", productPath.c_str());
+            return;
+        }
+        file.Close();
+
+        AssetBuilderSDK::JobProduct jobProduct(productPath.String(), AZ::Data::AssetType(HrtfAssetTypeId), 0);
+        jobProduct.m_dependenciesHandled = true;
+        response.m_outputProducts.push_back(AZStd::move(jobProduct));
+        response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
+    }
+
+    AZ_COMPONENT_IMPL(HrtfAssetBuilderComponent, "HrtfAssetBuilderComponent", HrtfAssetBuilderComponentTypeId);
+
+    void HrtfAssetBuilderComponent::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serializeContext->Class<HrtfAssetBuilderComponent, AZ::Component>()
+                ->Version(0)
+                ->Attribute(AZ::Edit::Attributes::SystemComponentTags, AZStd::vector<AZ::Crc32>({ AssetBuilderSDK::ComponentTags::AssetBuilder }));
+        }
+    }
+
+    void HrtfAssetBuilderComponent::Activate()
+    {
+        m_builder.RegisterBuilder();
+    }
+
+    void HrtfAssetBuilderComponent::Deactivate()
+    {
+        m_builder.UnregisterBuilder();
+    }
+} // namespace TuSteamAudio
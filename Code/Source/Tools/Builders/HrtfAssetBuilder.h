@@ -0,0 +1,53 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <AssetBuilderSDK/AssetBuilderBusses.h>
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+#include <AzCore/Component/Component.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace TuSteamAudio
+{
+    //! Turns .sofa HRTFs into .sahrtf products. Every sample rate in /TuSteamAudio/Hrtf/TargetSampleRates is checked
+    //! to load and measured against the default HRTF, so the runtime skips normalizing it.
+    class HrtfAssetBuilder
+        : public AssetBuilderSDK::AssetBuilderCommandBus::Handler
+    {
+    public:
+        void RegisterBuilder();
+        void UnregisterBuilder();
+
+        void CreateJobs(const AssetBuilderSDK::CreateJobsRequest& request, AssetBuilderSDK::CreateJobsResponse& response) const;
+        void ProcessJob(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response) const;
+
+        // AssetBuilderCommandBus
+        void ShutDown() override { m_isShuttingDown = true; }
+
+    private:
+        bool m_isShuttingDown = false;
+    };
+
+    //! /TuSteamAudio/Hrtf/TargetSampleRates, 44.1 and 48 kHz when unset.
+    AZStd::vector<AZ::u32> ReadHrtfTargetSampleRates();
+
+    //! Only active inside asset builder processes.
+    class HrtfAssetBuilderComponent
+        : public AZ::Component
+    {
+    public:
+        AZ_COMPONENT_DECL(HrtfAssetBuilderComponent);
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        void Activate() override;
+        void Deactivate() override;
+
+    private:
+        HrtfAssetBuilder m_builder;
+    };
+} // TuSteamAudio
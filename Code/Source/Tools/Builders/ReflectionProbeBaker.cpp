@@ -0,0 +1,225 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#include "ReflectionProbeBaker.h"
+
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <cmath>
+
+using namespace TuSteamAudio;
+
+namespace
+{
+    struct BakeProgress
+    {
+        IPLContext m_context = nullptr;
+        const AZStd::function<bool()>* m_isCancelled = nullptr;
+        int m_lastReported = -1;
+        bool m_cancelled = false;
+    };
+
+    void IPLCALL OnBakeProgress(IPLfloat32 progress, void* userData)
+    {
+        auto* state = static_cast<BakeProgress*>(userData);
+
+        const int percent = static_cast<int>(progress * 100.0f);
+        if (percent / 10 != state->m_lastReported / 10)
+        {
+            state->m_lastReported = percent;
+            AZ_TracePrintf("ReflectionProbeBaker", "Baking reverb %d%%\n", percent);
+        }
+
+        if (!state->m_cancelled && *state->m_isCancelled && (*state->m_isCancelled)())
+        {
+            state->m_cancelled = true;
+            iplReflectionsBakerCancelBake(state->m_context);
+        }
+    }
+
+    // Probe generation maps a unit cube centered on the origin through this transform
+    IPLMatrix4x4 BoundsToTransform(const IPLVector3& boundsMin, const IPLVector3& boundsMax)
+    {
+        IPLMatrix4x4 transform{};
+        transform.elements[0][0] = boundsMax.x - boundsMin.x;
+        transform.elements[1][1] = boundsMax.y - boundsMin.y;
+        transform.elements[2][2] = boundsMax.z - boundsMin.z;
+        transform.elements[0][3] = (boundsMax.x + boundsMin.x) * 0.5f;
+        transform.elements[1][3] = (boundsMax.y + boundsMin.y) * 0.5f;
+        transform.elements[2][3] = (boundsMax.z + boundsMin.z) * 0.5f;
+        transform.elements[3][3] = 1.0f;
+        return transform;
+    }
+}
+
+AZStd::string ProbeBakeSettings::GetFingerprint() const
+{
+    return AZStd::string::format("%u|%u|%.3f|%.3f|%.3f|%d|%d|%d|%.3f|%d|%.3f",
+        STEAMAUDIO_VERSION, AcousticProbeFile::Header::CurrentVersion, m_spacing, m_height, m_regionSize, m_numRays, m_numBounces, m_numDiffuseSamples, m_duration, m_order, m_irradianceMinDistance);
+}
+
+ProbeBakeSettings TuSteamAudio::ReadProbeBakeSettings()
+{
+    ProbeBakeSettings settings;
+    auto* registry = AZ::SettingsRegistry::Get();
+    if (!registry)
+    {
+        return settings;
+    }
+
+    const AZStd::string path = "/TuSteamAudio/Probes";
+    const AZStd::string reflectionsPath = "/TuSteamAudio/Simulation/Reflections";
+    AZ::s64 value = 0;
+    double number = 0.0;
+
+    registry->Get(settings.m_enabled, path + "/Enabled");
+    if (registry->Get(number, path + "/Spacing"))
+    {
+        settings.m_spacing = static_cast<float>(number);
+    }
+    if (registry->Get(number, path + "/Height"))
+    {
+        settings.m_height = static_cast<float>(number);
+    }
+    if (registry->Get(number, path + "/RegionSize"))
+    {
+        settings.m_regionSize = static_cast<float>(number);
+    }
+    if (registry->Get(value, path + "/NumRays"))
+    {
+        settings.m_numRays = static_cast<int>(value);
+    }
+    if (registry->Get(value, path + "/NumBounces"))
+    {
+        settings.m_numBounces = static_cast<int>(value);
+    }
+    if (registry->Get(value, path + "/NumDiffuseSamples"))
+    {
+        settings.m_numDiffuseSamples = static_cast<int>(value);
+    }
+    if (registry->Get(value, path + "/NumThreads"))
+    {
+        settings.m_numThreads = static_cast<int>(value);
+    }
+    if (registry->Get(number, reflectionsPath + "/Duration"))
+    {
+        settings.m_duration = static_cast<float>(number);
+    }
+    if (registry->Get(value, reflectionsPath + "/Order"))
+    {
+        settings.m_order = static_cast<int>(value);
+    }
+    return settings;
+}
+
+bool ReflectionProbeBaker::Bake(IPLContext context, IPLScene scene, const AcousticSceneFile::Header& sceneHeader,
+    const ProbeBakeSettings& settings, const AZStd::function<bool()>& isCancelled, AZStd::vector<AZ::u8>& out)
+{
+    // Regions are cut on the ground plane and span the full height of the level
+    const IPLVector3& boundsMin = sceneHeader.m_boundsMin;
+    const IPLVector3& boundsMax = sceneHeader.m_boundsMax;
+    const float regionSize = AZStd::max(settings.m_regionSize, settings.m_spacing);
+    const int regionsX = AZStd::max(1, static_cast<int>(std::ceil((boundsMax.x - boundsMin.x) / regionSize)));
+    const int regionsZ = AZStd::max(1, static_cast<int>(std::ceil((boundsMax.z - boundsMin.z) / regionSize)));
+
+    AZStd::vector<IPLProbeBatch> probeBatches;
+    AZStd::vector<AcousticProbeFile::Region> regions;
+    AZ::u32 totalProbes = 0;
+
+    for (int z = 0; z < regionsZ; ++z)
+    {
+        for (int x = 0; x < regionsX; ++x)
+        {
+            AcousticProbeFile::Region region;
+            region.m_boundsMin = { boundsMin.x + x * regionSize, boundsMin.y, boundsMin.z + z * regionSize };
+            region.m_boundsMax = { AZStd::min(region.m_boundsMin.x + regionSize, boundsMax.x), boundsMax.y,
+                AZStd::min(region.m_boundsMin.z + regionSize, boundsMax.z) };
+
+            IPLProbeArray probeArray = nullptr;
+            if (iplProbeArrayCreate(context, &probeArray) != IPL_STATUS_SUCCESS)
+            {
+                AZ_Error("ReflectionProbeBaker", false, "Failed to create probe array");
+                continue;
+            }
+
+            // Probes sit at head height above every floor, which keeps them to where a listener can actually be
+            IPLProbeGenerationParams generationParams{};
+            generationParams.type = IPL_PROBEGENERATIONTYPE_UNIFORMFLOOR;
+            generationParams.spacing = settings.m_spacing;
+            generationParams.height = settings.m_height;
+            generationParams.transform = BoundsToTransform(region.m_boundsMin, region.m_boundsMax);
+            iplProbeArrayGenerateProbes(probeArray, scene, &generationParams);
+
+            const int probeCount = iplProbeArrayGetNumProbes(probeArray);
+            IPLProbeBatch probeBatch = nullptr;
+            if (probeCount > 0 && iplProbeBatchCreate(context, &probeBatch) == IPL_STATUS_SUCCESS)
+            {
+                iplProbeBatchAddProbeArray(probeBatch, probeArray);
+                iplProbeBatchCommit(probeBatch);
+
+                region.m_probeCount = static_cast<AZ::u32>(probeCount);
+                totalProbes += region.m_probeCount;
+                probeBatches.push_back(probeBatch);
+                regions.push_back(region);
+            }
+            iplProbeArrayRelease(&probeArray);
+        }
+    }
+
+    if (probeBatches.empty())
+    {
+        AZ_Warning("ReflectionProbeBaker", false, "No floor found to place reflection probes on");
+        return false;
+    }
+
+    const int numThreads = settings.m_numThreads > 0 ?
+        settings.m_numThreads : AZStd::max(1, static_cast<int>(AZStd::thread::hardware_concurrency()));
+
+    IPLReflectionsBakeParams bakeParams{};
+    bakeParams.scene = scene;
+    bakeParams.sceneType = IPL_SCENETYPE_DEFAULT;
+    bakeParams.identifier = AcousticProbeFile::BakedReverb;
+    bakeParams.bakeFlags = IPL_REFLECTIONSBAKEFLAGS_BAKECONVOLUTION;
+    bakeParams.numRays = settings.m_numRays;
+    bakeParams.numDiffuseSamples = settings.m_numDiffuseSamples;
+    bakeParams.numBounces = settings.m_numBounces;
+    bakeParams.simulatedDuration = settings.m_duration;
+    bakeParams.savedDuration = settings.m_duration;
+    bakeParams.order = settings.m_order;
+    bakeParams.numThreads = numThreads;
+    bakeParams.irradianceMinDistance = settings.m_irradianceMinDistance;
+
+    // Each region bakes on every thread in turn, the scene is shared
+    BakeProgress progress;
+    progress.m_context = context;
+    progress.m_isCancelled = &isCancelled;
+    for (size_t i = 0; i < probeBatches.size() && !progress.m_cancelled; ++i)
+    {
+        AZ_TracePrintf("ReflectionProbeBaker", "Baking region %zu/%zu, %u probes on %d threads\n",
+            i + 1, probeBatches.size(), regions[i].m_probeCount, numThreads);
+        progress.m_lastReported = -1;
+        bakeParams.probeBatch = probeBatches[i];
+        iplReflectionsBakerBake(context, &bakeParams, &OnBakeProgress, &progress);
+    }
+
+    bool baked = !progress.m_cancelled;
+    if (baked)
+    {
+        AcousticProbeFile::Header probeInfo;
+        probeInfo.m_probeCount = totalProbes;
+        probeInfo.m_order = static_cast<AZ::u32>(settings.m_order);
+        probeInfo.m_duration = settings.m_duration;
+        probeInfo.m_regionSize = regionSize;
+        baked = AcousticProbeFile::Serialize(context, probeBatches, regions, probeInfo, out);
+    }
+
+    for (IPLProbeBatch& probeBatch : probeBatches)
+    {
+        iplProbeBatchRelease(&probeBatch);
+    }
+    return baked;
+}
@@ -0,0 +1,48 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#pragma once
+
+#include <Clients/Scene/AcousticProbeFile.h>
+
+#include <AzCore/std/function/function_template.h>
+#include <AzCore/std/string/string.h>
+
+namespace TuSteamAudio
+{
+    //! /TuSteamAudio/Probes, plus the order and duration of /TuSteamAudio/Simulation/Reflections
+    //! so baked IRs always fit the runtime reflection effects.
+    struct ProbeBakeSettings
+    {
+        bool m_enabled = true;
+        //! Distance between probes and their height above the floor, in meters.
+        float m_spacing = 2.0f;
+        float m_height = 1.5f;
+        //! Probes are split into square grid cells of this size, each streamed in on its own.
+        float m_regionSize = 64.0f;
+        int m_numRays = 32768;
+        int m_numBounces = 64;
+        int m_numDiffuseSamples = 1024;
+        float m_duration = 2.0f;
+        int m_order = 1;
+        float m_irradianceMinDistance = 1.0f;
+        //! 0 bakes on every hardware thread.
+        int m_numThreads = 0;
+
+        //! Everything that changes the baked result, for the asset processor job fingerprint.
+        AZStd::string GetFingerprint() const;
+    };
+
+    ProbeBakeSettings ReadProbeBakeSettings();
+
+    namespace ReflectionProbeBaker
+    {
+        //! Generates probes on the floors inside the scene's bounds and bakes listener centric reverb into them,
+        //! one probe batch per grid region. Blocks for the whole bake, isCancelled is polled from the progress callback.
+        bool Bake(IPLContext context, IPLScene scene, const AcousticSceneFile::Header& sceneHeader,
+            const ProbeBakeSettings& settings, const AZStd::function<bool()>& isCancelled, AZStd::vector<AZ::u8>& out);
+    } // ReflectionProbeBaker
+} // TuSteamAudio
@@ -60,6 +60,8 @@ void EditorSAPlayerComponent::Reflect(AZ::ReflectContext* context)
                 ->EnumAttribute(DistanceModel::InverseDistance, "Inverse Distance")
                 ->EnumAttribute(DistanceModel::TuAttenuation, "TuAttenuation")
             ->DataElement(UIHandlers::Default, &SAPlayerComponentConfig::m_attenuation, "Attenuation", "The attenuation settings to use")
+            ->DataElement(UIHandlers::CheckBox, &SAPlayerComponentConfig::m_batchedSpatialization, "Batched Spatialization",
+                "Spatialize through the shared mixer instead of a per player node. Cheaper with many emitters, applied on activation.")
         ;
     }
 }
@@ -103,6 +105,8 @@ void EditorSAPlayerComponent::DisplayEntityViewport(const AzFramework::ViewportI
     if (m_controller.m_config.m_attenuation.m_shape == Attenuation::Shape::Sphere) {
         auto attenuation = m_controller.m_config.m_attenuation;
 
+        m_attenuationTable.Build(attenuation);
+
         auto innerRadius = attenuation.m_innerRadius;
         auto outerRadius = attenuation.m_falloffDistance;
 
@@ -121,7 +125,7 @@ void EditorSAPlayerComponent::DisplayEntityViewport(const AzFramework::ViewportI
         while (dist <= outerRadius)
         {
             dist += 0.5f;
-            float attenuationValue = attenuation.CalculateAttenuation(dist);
+            float attenuationValue = m_attenuationTable.Lookup(dist);
             AZ::Vector4 color = AZ::Lerp(noAudioColor, positiveColor, attenuationValue);
             dbg.DrawLine({lastDist, 0, 0}, {dist, 0, 0}, lastColor, color);
             lastDist = dist;
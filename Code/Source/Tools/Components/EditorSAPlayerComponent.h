@@ -13,6 +13,7 @@
 #include "Clients/Components/Configs/SAPlayerComponentConfig.h"
 #include "Clients/Components/Controllers/SAPlayerComponentController.h"
 #include "Clients/Components/SAPlayerComponent.h"
+#include "TuSteamAudio/AttenuationTable.h"
 
 namespace TuSteamAudio
 {
@@ -38,5 +39,9 @@ namespace TuSteamAudio
 
         AZ::u32 OnDistanceModelChanged();
         AZ::u32 OnAttenuationSettingsChanged();
+
+    private:
+        //Compiled from the config when it changes, sampled by the viewport gradient every frame
+        Attenuation::AttenuationTable m_attenuationTable;
     };
 } // TuSteamAudio
\ No newline at end of file
@@ -8,6 +8,8 @@
 #include <TuSteamAudioModuleInterface.h>
 #include "TuSteamAudioEditorSystemComponent.h"
 #include "Components/EditorSAPlayerComponent.h"
+#include "Builders/AcousticSceneAssetBuilder.h"
+#include "Builders/HrtfAssetBuilder.h"
 
 namespace TuSteamAudio
 {
@@ -26,7 +28,9 @@ namespace TuSteamAudio
             // This happens through the [MyComponent]::Reflect() function.
             m_descriptors.insert(m_descriptors.end(), {
                 TuSteamAudioEditorSystemComponent::CreateDescriptor(),
-                EditorSAPlayerComponent::CreateDescriptor()
+                EditorSAPlayerComponent::CreateDescriptor(),
+                AcousticSceneAssetBuilderComponent::CreateDescriptor(),
+                HrtfAssetBuilderComponent::CreateDescriptor()
             });
         }
 
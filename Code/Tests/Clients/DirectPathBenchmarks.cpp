@@ -0,0 +1,138 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+#include <AzCore/std/containers/vector.h>
+#include <phonon.h>
+#include <cmath>
+
+#include "Clients/Effects/DirectPathKernel.h"
+
+namespace TuSteamAudio::Benchmarks
+{
+    // Direct path parameters for N sources, what the spatial mixer works out every quantum.
+    // PerSourceSteamAudio is the mixer's old path, three Steam Audio calls per source.
+    class DirectPathFixture : public benchmark::Fixture
+    {
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            IPLContextSettings contextSettings{};
+            contextSettings.version = STEAMAUDIO_VERSION;
+            iplContextCreate(&contextSettings, &m_context);
+
+            m_listener.origin = { 1.0f, 1.7f, -2.0f };
+            m_listener.right = { 1.0f, 0.0f, 0.0f };
+            m_listener.up = { 0.0f, 1.0f, 0.0f };
+            m_listener.ahead = { 0.0f, 0.0f, -1.0f };
+
+            m_numSources = static_cast<AZ::u32>(state.range(0));
+            for (AZ::u32 i = 0; i < m_numSources; ++i)
+            {
+                // Spiral out from the listener so distances and directions all differ
+                const float angle = 2.3999632f * i;
+                const float radius = 0.5f + 0.25f * i;
+                m_positionX.push_back(radius * std::sin(angle));
+                m_positionY.push_back(1.0f + 0.1f * (i % 7));
+                m_positionZ.push_back(-radius * std::cos(angle));
+                m_minDistance.push_back(1.0f);
+            }
+
+            m_sources.m_positionX = m_positionX.data();
+            m_sources.m_positionY = m_positionY.data();
+            m_sources.m_positionZ = m_positionZ.data();
+            m_sources.m_minDistance = m_minDistance.data();
+            m_sources.m_count = m_numSources;
+            m_results.Resize(m_numSources);
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            m_positionX.clear();
+            m_positionY.clear();
+            m_positionZ.clear();
+            m_minDistance.clear();
+            iplContextRelease(&m_context);
+        }
+
+    protected:
+        IPLContext m_context = nullptr;
+        IPLCoordinateSpace3 m_listener = {};
+        AZStd::vector<float> m_positionX;
+        AZStd::vector<float> m_positionY;
+        AZStd::vector<float> m_positionZ;
+        AZStd::vector<float> m_minDistance;
+        DirectPathSources m_sources;
+        DirectPathResults m_results;
+        AZ::u32 m_numSources = 0;
+    };
+
+    BENCHMARK_DEFINE_F(DirectPathFixture, PerSourceSteamAudio)(benchmark::State& state)
+    {
+        IPLDistanceAttenuationModel distanceModel{};
+        distanceModel.type = IPL_DISTANCEATTENUATIONTYPE_DEFAULT;
+        IPLAirAbsorptionModel airAbsorptionModel{};
+        airAbsorptionModel.type = IPL_AIRABSORPTIONTYPE_DEFAULT;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (AZ::u32 i = 0; i < m_numSources; ++i)
+            {
+                const IPLVector3 source = { m_positionX[i], m_positionY[i], m_positionZ[i] };
+                const IPLVector3 direction = iplCalculateRelativeDirection(m_context, source, m_listener.origin, m_listener.ahead, m_listener.up);
+                m_results.m_directionX[i] = direction.x;
+                m_results.m_directionY[i] = direction.y;
+                m_results.m_directionZ[i] = direction.z;
+                m_results.m_distanceAttenuation[i] = iplDistanceAttenuationCalculate(m_context, source, m_listener.origin, &distanceModel);
+
+                float airAbsorption[3];
+                iplAirAbsorptionCalculate(m_context, source, m_listener.origin, &airAbsorptionModel, airAbsorption);
+                for (int band = 0; band < 3; ++band)
+                {
+                    m_results.m_airAbsorption[band][i] = airAbsorption[band];
+                }
+            }
+            benchmark::DoNotOptimize(m_results.m_airAbsorption[2].data());
+        }
+        state.counters["Sources"] = static_cast<double>(m_numSources);
+    }
+
+    BENCHMARK_DEFINE_F(DirectPathFixture, Scalar)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            CalculateDirectPathsScalar(m_listener, m_sources, DefaultAirAbsorptionCoefficients, m_results);
+            benchmark::DoNotOptimize(m_results.m_airAbsorption[2].data());
+        }
+        state.counters["Sources"] = static_cast<double>(m_numSources);
+    }
+
+    BENCHMARK_DEFINE_F(DirectPathFixture, Batched)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            CalculateDirectPaths(m_listener, m_sources, DefaultAirAbsorptionCoefficients, m_results);
+            benchmark::DoNotOptimize(m_results.m_airAbsorption[2].data());
+        }
+        state.counters["Sources"] = static_cast<double>(m_numSources);
+    }
+
+    BENCHMARK_REGISTER_F(DirectPathFixture, PerSourceSteamAudio)
+        ->Arg(64)->Arg(256)->Arg(512)->Arg(1024)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(DirectPathFixture, Scalar)
+        ->Arg(64)->Arg(256)->Arg(512)->Arg(1024)
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(DirectPathFixture, Batched)
+        ->Arg(64)->Arg(256)->Arg(512)->Arg(1024)
+        ->Unit(benchmark::kMicrosecond);
+} // namespace TuSteamAudio::Benchmarks
+
+#endif
@@ -0,0 +1,165 @@
+/*
+* SPDX-License-Identifier: MIT
+ * SPDX-FileCopyrightText: Copyright (c) 2025+ Reece Hagan
+ *
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ */
+#if defined(HAVE_BENCHMARK)
+
+#include <benchmark/benchmark.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/algorithm.h>
+#include <phonon.h>
+#include <cmath>
+
+#include "Clients/Effects/AmbisonicsBus.h"
+
+namespace TuSteamAudio::Benchmarks
+{
+    // Compares the two spatial mixer render modes for N sources.
+    // Per source binaural cost grows with N, the ambisonic bus pays one decode per quantum
+    // plus a cheap encode per source. Run both with the same N to find the crossover.
+    class SpatialRenderFixture : public benchmark::Fixture
+    {
+    public:
+        static constexpr int FrameSize = 512;
+        static constexpr int SamplingRate = 48000;
+
+        void SetUp(const benchmark::State& state) override
+        {
+            IPLContextSettings contextSettings{};
+            contextSettings.version = STEAMAUDIO_VERSION;
+            iplContextCreate(&contextSettings, &m_context);
+
+            m_audioSettings.samplingRate = SamplingRate;
+            m_audioSettings.frameSize = FrameSize;
+
+            IPLHRTFSettings hrtfSettings{};
+            hrtfSettings.type = IPL_HRTFTYPE_DEFAULT;
+            hrtfSettings.volume = 1.0f;
+            iplHRTFCreate(m_context, &m_audioSettings, &hrtfSettings, &m_hrtf);
+
+            m_numSources = static_cast<int>(state.range(0));
+            m_order = state.range(1) > 0 ? static_cast<int>(state.range(1)) : 2;
+
+            iplAudioBufferAllocate(m_context, 1, FrameSize, &m_input);
+            iplAudioBufferAllocate(m_context, 2, FrameSize, &m_stereo);
+            iplAudioBufferAllocate(m_context, AmbisonicsBus::GetNumChannels(m_order), FrameSize, &m_encoded);
+            for (int frame = 0; frame < FrameSize; ++frame)
+            {
+                m_input.data[0][frame] = (frame % 64) < 32 ? 0.5f : -0.5f;
+            }
+
+            m_bus.Create(m_context, m_audioSettings, m_hrtf, m_order);
+
+            for (int i = 0; i < m_numSources; ++i)
+            {
+                IPLBinauralEffectSettings binauralSettings{};
+                binauralSettings.hrtf = m_hrtf;
+                IPLBinauralEffect binaural = nullptr;
+                iplBinauralEffectCreate(m_context, &m_audioSettings, &binauralSettings, &binaural);
+                m_binauralEffects.push_back(binaural);
+
+                IPLAmbisonicsEncodeEffectSettings encodeSettings{};
+                encodeSettings.maxOrder = m_order;
+                IPLAmbisonicsEncodeEffect encode = nullptr;
+                iplAmbisonicsEncodeEffectCreate(m_context, &m_audioSettings, &encodeSettings, &encode);
+                m_encodeEffects.push_back(encode);
+
+                // Spread sources around the listener so the HRTF lookups differ
+                const float angle = 6.2831853f * i / AZStd::max(m_numSources, 1);
+                m_directions.push_back(IPLVector3{ std::sin(angle), 0.0f, -std::cos(angle) });
+            }
+        }
+
+        void TearDown(const benchmark::State&) override
+        {
+            for (IPLBinauralEffect& effect : m_binauralEffects)
+            {
+                iplBinauralEffectRelease(&effect);
+            }
+            for (IPLAmbisonicsEncodeEffect& effect : m_encodeEffects)
+            {
+                iplAmbisonicsEncodeEffectRelease(&effect);
+            }
+            m_binauralEffects.clear();
+            m_encodeEffects.clear();
+            m_directions.clear();
+
+            m_bus.Release();
+            iplAudioBufferFree(m_context, &m_input);
+            iplAudioBufferFree(m_context, &m_stereo);
+            iplAudioBufferFree(m_context, &m_encoded);
+            iplHRTFRelease(&m_hrtf);
+            iplContextRelease(&m_context);
+        }
+
+    protected:
+        IPLContext m_context = nullptr;
+        IPLHRTF m_hrtf = nullptr;
+        IPLAudioSettings m_audioSettings = {};
+        IPLAudioBuffer m_input = {};
+        IPLAudioBuffer m_stereo = {};
+        IPLAudioBuffer m_encoded = {};
+        AmbisonicsBus m_bus;
+
+        AZStd::vector<IPLBinauralEffect> m_binauralEffects;
+        AZStd::vector<IPLAmbisonicsEncodeEffect> m_encodeEffects;
+        AZStd::vector<IPLVector3> m_directions;
+        int m_numSources = 0;
+        int m_order = 2;
+    };
+
+    BENCHMARK_DEFINE_F(SpatialRenderFixture, PerSourceBinaural)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (int i = 0; i < m_numSources; ++i)
+            {
+                IPLBinauralEffectParams params{};
+                params.direction = m_directions[i];
+                params.interpolation = IPL_HRTFINTERPOLATION_BILINEAR;
+                params.spatialBlend = 1.0f;
+                params.hrtf = m_hrtf;
+                iplBinauralEffectApply(m_binauralEffects[i], &params, &m_input, &m_stereo);
+            }
+            benchmark::DoNotOptimize(m_stereo.data[0][0]);
+        }
+        state.counters["Sources"] = static_cast<double>(m_numSources);
+    }
+
+    BENCHMARK_DEFINE_F(SpatialRenderFixture, AmbisonicBus)(benchmark::State& state)
+    {
+        IPLCoordinateSpace3 listener{};
+        listener.right = { 1.0f, 0.0f, 0.0f };
+        listener.up = { 0.0f, 1.0f, 0.0f };
+        listener.ahead = { 0.0f, 0.0f, -1.0f };
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            m_bus.Clear();
+            for (int i = 0; i < m_numSources; ++i)
+            {
+                IPLAmbisonicsEncodeEffectParams params{};
+                params.direction = m_directions[i];
+                params.order = m_order;
+                iplAmbisonicsEncodeEffectApply(m_encodeEffects[i], &params, &m_input, &m_encoded);
+                m_bus.Accumulate(m_encoded);
+            }
+            m_bus.Decode(listener, m_stereo);
+            benchmark::DoNotOptimize(m_stereo.data[0][0]);
+        }
+        state.counters["Sources"] = static_cast<double>(m_numSources);
+        state.counters["Order"] = static_cast<double>(m_order);
+    }
+
+    BENCHMARK_REGISTER_F(SpatialRenderFixture, PerSourceBinaural)
+        ->ArgsProduct({ { 1, 2, 4, 8, 16, 32, 64, 128, 256 }, { 0 } })
+        ->Unit(benchmark::kMicrosecond);
+
+    BENCHMARK_REGISTER_F(SpatialRenderFixture, AmbisonicBus)
+        ->ArgsProduct({ { 1, 2, 4, 8, 16, 32, 64, 128, 256 }, { 1, 2, 3 } })
+        ->Unit(benchmark::kMicrosecond);
+} // namespace TuSteamAudio::Benchmarks
+
+#endif
@@ -5,5 +5,344 @@
  * For complete copyright and license terms please see the LICENSE at the root of this distribution.
  */
 #include <AzTest/AzTest.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+
+#include <TuSteamAudio/AttenuationTable.h>
+#include "Clients/Effects/DirectPathKernel.h"
+#include "Clients/Effects/ReblockingFifo.h"
+
+#include <cmath>
+#include <limits>
+
+namespace TuSteamAudio::Tests
+{
+    using Attenuation::AttenuationTable;
+    using Attenuation::TuAttenuation;
+
+    constexpr TuAttenuation::CurveType CurveTypes[] = {
+        TuAttenuation::CurveType::Linear,
+        TuAttenuation::CurveType::Logarithmic,
+        TuAttenuation::CurveType::Inverse,
+        TuAttenuation::CurveType::LogReverse,
+        TuAttenuation::CurveType::NaturalSound
+    };
+
+    // Float rounding in the lookup and in the reference, on top of the interpolation bound
+    constexpr float RoundingSlack = 1e-6f;
+
+    // Both sides of the inner radius and of the end of the falloff, where the curves jump, and a sweep across the
+    // falloff that isn't a multiple of the table resolution so it lands between samples.
+    void ExpectWithinMaxError(float innerRadius, float falloffDistance)
+    {
+        constexpr float Up = std::numeric_limits<float>::max();
+        constexpr AZ::u32 Steps = 10007;
+
+        const float outerRadius = innerRadius + falloffDistance;
+        AZStd::vector<float> distances = {
+            0.0f, std::nextafter(0.0f, Up),
+            std::nextafter(innerRadius, 0.0f), innerRadius, std::nextafter(innerRadius, Up),
+            std::nextafter(outerRadius, 0.0f), outerRadius, std::nextafter(outerRadius, Up),
+            outerRadius + 1.0f
+        };
+        for (AZ::u32 i = 0; i <= Steps; ++i)
+        {
+            distances.push_back(innerRadius + falloffDistance * static_cast<float>(i) / static_cast<float>(Steps));
+        }
+
+        for (TuAttenuation::CurveType curveType : CurveTypes)
+        {
+            TuAttenuation settings;
+            settings.m_innerRadius = innerRadius;
+            settings.m_falloffDistance = falloffDistance;
+            settings.m_curveType = curveType;
+
+            AttenuationTable table;
+            table.Build(settings);
+
+            for (float distance : distances)
+            {
+                EXPECT_NEAR(table.Lookup(distance), settings.CalculateAttenuation(distance), table.GetMaxError() + RoundingSlack)
+                    << "curve " << static_cast<int>(curveType) << ", inner radius " << innerRadius
+                    << ", falloff " << falloffDistance << ", distance " << distance;
+            }
+        }
+    }
+
+    TEST(AttenuationTableTest, Lookup_EveryCurve_StaysWithinMaxError)
+    {
+        ExpectWithinMaxError(1.0f, 100.0f);
+        ExpectWithinMaxError(0.5f, 20.0f);
+        ExpectWithinMaxError(10.0f, 1000.0f);
+        ExpectWithinMaxError(5.0f, 0.5f);
+    }
+
+    TEST(AttenuationTableTest, Lookup_ZeroInnerRadius_StaysWithinMaxError)
+    {
+        ExpectWithinMaxError(0.0f, 10.0f);
+        ExpectWithinMaxError(0.0f, 1e-3f);
+    }
+
+    TEST(AttenuationTableTest, Lookup_FalloffTowardsZero_StaysWithinMaxError)
+    {
+        ExpectWithinMaxError(2.0f, 1e-3f);
+        ExpectWithinMaxError(2.0f, 1e-6f);
+        ExpectWithinMaxError(0.0f, 1e-6f);
+        // Silent past the inner radius, same as the reference
+        ExpectWithinMaxError(3.0f, 0.0f);
+        ExpectWithinMaxError(0.0f, 0.0f);
+    }
+
+    // Listener away from the origin and turned about two axes, so every component of the basis counts
+    IPLCoordinateSpace3 MakeListener()
+    {
+        const float yaw = 0.7f;
+        const float pitch = 0.3f;
+        IPLCoordinateSpace3 listener;
+        listener.origin = { 3.0f, 1.7f, -2.0f };
+        listener.right = { std::cos(yaw), 0.0f, -std::sin(yaw) };
+        listener.up = { std::sin(yaw) * std::sin(pitch), std::cos(pitch), std::cos(yaw) * std::sin(pitch) };
+        listener.ahead = { -std::sin(yaw) * std::cos(pitch), std::sin(pitch), -std::cos(yaw) * std::cos(pitch) };
+        return listener;
+    }
+
+    struct DirectPathBatch
+    {
+        void Add(const IPLVector3& position, float minDistance)
+        {
+            m_positionX.push_back(position.x);
+            m_positionY.push_back(position.y);
+            m_positionZ.push_back(position.z);
+            m_minDistance.push_back(minDistance);
+        }
+
+        DirectPathSources GetSources() const
+        {
+            DirectPathSources sources;
+            sources.m_positionX = m_positionX.data();
+            sources.m_positionY = m_positionY.data();
+            sources.m_positionZ = m_positionZ.data();
+            sources.m_minDistance = m_minDistance.data();
+            sources.m_count = static_cast<AZ::u32>(m_positionX.size());
+            return sources;
+        }
+
+        AZStd::vector<float> m_positionX;
+        AZStd::vector<float> m_positionY;
+        AZStd::vector<float> m_positionZ;
+        AZStd::vector<float> m_minDistance;
+    };
+
+    // The batched kernel against the one source at a time version. Air absorption is held to the header's 1e-5 of
+    // the result, down to -120 dB where nothing is audible anymore.
+    void ExpectMatchesScalar(const IPLCoordinateSpace3& listener, const DirectPathBatch& batch)
+    {
+        constexpr float DirectionTolerance = 1e-5f;
+        constexpr float RelativeTolerance = 1e-6f;
+        constexpr float AbsorptionTolerance = 1e-5f;
+        constexpr float InaudibleGain = 1e-6f;
+
+        const DirectPathSources sources = batch.GetSources();
+        DirectPathResults batched;
+        DirectPathResults scalar;
+        batched.Resize(sources.m_count);
+        scalar.Resize(sources.m_count);
+        CalculateDirectPaths(listener, sources, DefaultAirAbsorptionCoefficients, batched);
+        CalculateDirectPathsScalar(listener, sources, DefaultAirAbsorptionCoefficients, scalar);
+
+        for (AZ::u32 i = 0; i < sources.m_count; ++i)
+        {
+            EXPECT_NEAR(batched.m_directionX[i], scalar.m_directionX[i], DirectionTolerance) << "source " << i << " of " << sources.m_count;
+            EXPECT_NEAR(batched.m_directionY[i], scalar.m_directionY[i], DirectionTolerance) << "source " << i << " of " << sources.m_count;
+            EXPECT_NEAR(batched.m_directionZ[i], scalar.m_directionZ[i], DirectionTolerance) << "source " << i << " of " << sources.m_count;
+            EXPECT_NEAR(batched.m_distance[i], scalar.m_distance[i], scalar.m_distance[i] * RelativeTolerance)
+                << "source " << i << " of " << sources.m_count;
+            EXPECT_NEAR(batched.m_distanceAttenuation[i], scalar.m_distanceAttenuation[i], scalar.m_distanceAttenuation[i] * RelativeTolerance)
+                << "source " << i << " of " << sources.m_count;
+            for (int band = 0; band < 3; ++band)
+            {
+                const float expected = scalar.m_airAbsorption[band][i];
+                EXPECT_NEAR(batched.m_airAbsorption[band][i], expected, AZStd::max(expected * AbsorptionTolerance, InaudibleGain))
+                    << "source " << i << " of " << sources.m_count << ", band " << band << ", distance " << scalar.m_distance[i];
+            }
+        }
+    }
+
+    TEST(DirectPathKernelTest, CalculateDirectPaths_EveryTailLength_MatchesScalar)
+    {
+        const IPLCoordinateSpace3 listener = MakeListener();
+        for (AZ::u32 count = 0; count <= 9; ++count)
+        {
+            // Spiral out from the listener so directions and distances all differ, min distances on both sides of them
+            DirectPathBatch batch;
+            for (AZ::u32 i = 0; i < count; ++i)
+            {
+                const float angle = 2.3999632f * i;
+                const float radius = 0.5f + 0.75f * i;
+                const IPLVector3 position = { listener.origin.x + radius * std::sin(angle), listener.origin.y + 0.3f * i - 1.0f,
+                    listener.origin.z + radius * std::cos(angle) };
+                batch.Add(position, (i % 3 == 0) ? 1.0f : 0.25f * i);
+            }
+            ExpectMatchesScalar(listener, batch);
+        }
+    }
+
+    TEST(DirectPathKernelTest, CalculateDirectPaths_SourceOnListener_MatchesScalar)
+    {
+        // One on the listener and one closer than the direction can be worked out, in the vector part and in the tail
+        const IPLCoordinateSpace3 listener = MakeListener();
+        const IPLVector3 nearly = { listener.origin.x + 1e-7f, listener.origin.y, listener.origin.z };
+        DirectPathBatch batch;
+        batch.Add({ 10.0f, 0.0f, 0.0f }, 1.0f);
+        batch.Add(listener.origin, 1.0f);
+        batch.Add(nearly, 0.5f);
+        batch.Add({ -4.0f, 2.0f, 7.0f }, 1.0f);
+        batch.Add({ 0.0f, 0.0f, 0.0f }, 1.0f);
+        batch.Add(listener.origin, 2.0f);
+        batch.Add(nearly, 1.0f);
+        ExpectMatchesScalar(listener, batch);
+
+        DirectPathResults results;
+        results.Resize(batch.GetSources().m_count);
+        CalculateDirectPaths(listener, batch.GetSources(), DefaultAirAbsorptionCoefficients, results);
+        for (AZ::u32 i : { 1u, 5u })
+        {
+            EXPECT_EQ(results.m_directionX[i], 0.0f);
+            EXPECT_EQ(results.m_directionY[i], 0.0f);
+            EXPECT_EQ(results.m_directionZ[i], 0.0f);
+            EXPECT_EQ(results.m_distance[i], 0.0f);
+            EXPECT_EQ(results.m_airAbsorption[0][i], 1.0f);
+        }
+    }
+
+    TEST(DirectPathKernelTest, CalculateDirectPaths_PastAbsorptionClamp_MatchesScalar)
+    {
+        // The highest band reaches the exponent clamp of 80 at about 4.4km, the sweep runs half as far again
+        const IPLCoordinateSpace3 listener = MakeListener();
+        const float clampDistance = 80.0f / DefaultAirAbsorptionCoefficients[2];
+        constexpr AZ::u32 Steps = 203;
+        DirectPathBatch batch;
+        for (AZ::u32 i = 0; i <= Steps; ++i)
+        {
+            const float distance = 1.5f * clampDistance * static_cast<float>(i) / static_cast<float>(Steps);
+            const IPLVector3 position = { listener.origin.x + distance * 0.6f, listener.origin.y - distance * 0.48f,
+                listener.origin.z + distance * 0.64f };
+            batch.Add(position, 1.0f);
+        }
+        ExpectMatchesScalar(listener, batch);
+    }
+
+    // Runs quanta through a reblocker the way the nodes do, a frame doing nothing but pass its input on. Every input
+    // sample is its own position on the sample clock plus one, so the output shows exactly how far it trails.
+    void ExpectDelayedByLatency(int frameSize, int quantumSize, AZ::u64 startFrame)
+    {
+        constexpr int MaxQuantum = 480;
+        const int numQuanta = 4 * (frameSize / quantumSize + 2);
+
+        FrameReblocker reblocker;
+        reblocker.Allocate(1, 1, frameSize, MaxQuantum);
+        AZStd::vector<float> input(quantumSize);
+        AZStd::vector<float> frame(frameSize);
+        AZStd::vector<float> output(quantumSize);
+        float* inputData = input.data();
+        float* frameData = frame.data();
+        float* outputData = output.data();
+
+        int latency = -1;
+        AZ::u64 framePosition = 0;
+        for (int quantum = 0; quantum < numQuanta; ++quantum)
+        {
+            const AZ::u64 sampleFrame = startFrame + static_cast<AZ::u64>(quantum) * quantumSize;
+            ASSERT_TRUE(reblocker.Begin(sampleFrame, quantumSize));
+            if (quantum == 0)
+            {
+                latency = reblocker.GetLatency();
+                // The input FIFO was padded back to the start of the frame the node started in, the output can't
+                // trail by less than that padding nor by a whole frame
+                const int offset = static_cast<int>(sampleFrame % static_cast<AZ::u64>(frameSize));
+                ASSERT_GE(latency, offset);
+                ASSERT_LT(latency, frameSize);
+                framePosition = sampleFrame - offset;
+            }
+            ASSERT_EQ(reblocker.GetLatency(), latency) << "latency changed in quantum " << quantum;
+
+            for (int i = 0; i < quantumSize; ++i)
+            {
+                input[i] = static_cast<float>(sampleFrame + i + 1);
+            }
+
+            int frames = 0;
+            if (reblocker.IsPassthrough())
+            {
+                output = input;
+                frames = 1;
+            }
+            else
+            {
+                reblocker.GetInput().Write(&inputData, 1, quantumSize);
+                while (reblocker.GetInput().GetSize() >= frameSize)
+                {
+                    EXPECT_EQ(framePosition % static_cast<AZ::u64>(frameSize), 0u) << "frame off the grid in quantum " << quantum;
+                    reblocker.GetInput().Read(&frameData, frameSize);
+                    reblocker.GetOutput().Write(&frameData, 1, frameSize);
+                    framePosition += frameSize;
+                    ++frames;
+                }
+                ASSERT_GE(reblocker.GetOutput().GetSize(), quantumSize) << "output ran dry in quantum " << quantum;
+                reblocker.GetOutput().Read(&outputData, quantumSize);
+            }
+            EXPECT_EQ(frames, reblocker.GetFrameCount()) << "quantum " << quantum;
+
+            for (int i = 0; i < quantumSize; ++i)
+            {
+                const AZ::u64 position = sampleFrame + i;
+                const float expected = position >= startFrame + latency ? static_cast<float>(position - latency + 1) : 0.0f;
+                ASSERT_EQ(output[i], expected) << "frame size " << frameSize << ", quantum " << quantumSize << ", start " << startFrame
+                    << ", sample " << position << ", latency " << latency;
+            }
+        }
+    }
+
+    TEST(FrameReblockerTest, Begin_QuantaOnTheGrid_DelaysByLatency)
+    {
+        for (int frameSize : { 256, 1024 })
+        {
+            for (int quantumSize : { 128, 256, 480 })
+            {
+                ExpectDelayedByLatency(frameSize, quantumSize, 0);
+                ExpectDelayedByLatency(frameSize, quantumSize, 4096);
+            }
+        }
+    }
+
+    TEST(FrameReblockerTest, Begin_StartOffTheGrid_DelaysByLatency)
+    {
+        for (int frameSize : { 256, 1024 })
+        {
+            for (int quantumSize : { 128, 256, 480 })
+            {
+                ExpectDelayedByLatency(frameSize, quantumSize, 128);
+                ExpectDelayedByLatency(frameSize, quantumSize, 4096 + 480);
+                ExpectDelayedByLatency(frameSize, quantumSize, 1000003);
+            }
+        }
+    }
+
+    TEST(FrameReblockerTest, Begin_MatchingFrames_IsPassthrough)
+    {
+        FrameReblocker reblocker;
+        reblocker.Allocate(1, 1, 256, 480);
+        ASSERT_TRUE(reblocker.Begin(512, 256));
+        EXPECT_TRUE(reblocker.IsPassthrough());
+        EXPECT_EQ(reblocker.GetLatency(), 0);
+
+        // Same size off the grid has to reblock
+        ASSERT_TRUE(reblocker.Begin(640, 256));
+        EXPECT_FALSE(reblocker.IsPassthrough());
+        EXPECT_EQ(reblocker.GetLatency(), 128);
+
+        EXPECT_FALSE(reblocker.Begin(896, 512));
+    }
+} // TuSteamAudio::Tests
 
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -11,4 +11,14 @@ set(FILES
 
     Source/Tools/Components/EditorSAPlayerComponent.cpp
     Source/Tools/Components/EditorSAPlayerComponent.h
+
+    Source/Tools/AcousticSceneExporter.cpp
+    Source/Tools/AcousticSceneExporter.h
+
+    Source/Tools/Builders/AcousticSceneAssetBuilder.cpp
+    Source/Tools/Builders/AcousticSceneAssetBuilder.h
+    Source/Tools/Builders/HrtfAssetBuilder.cpp
+    Source/Tools/Builders/HrtfAssetBuilder.h
+    Source/Tools/Builders/ReflectionProbeBaker.cpp
+    Source/Tools/Builders/ReflectionProbeBaker.h
 )
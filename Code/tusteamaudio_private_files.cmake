@@ -6,8 +6,57 @@ set(FILES
     Source/Clients/TuSteamAudioSystemComponent.h
     Source/Clients/Effects/SteamAudioHrtf.cpp
     Source/Clients/Effects/SteamAudioHrtf.h
+    Source/Clients/Effects/TripleBuffer.h
+    Source/Clients/Effects/PoseRamp.h
+    Source/Clients/Effects/ReblockingFifo.h
+    Source/Clients/Effects/ListenerCache.cpp
+    Source/Clients/Effects/ListenerCache.h
+    Source/Clients/Effects/AudibilityManager.cpp
+    Source/Clients/Effects/AudibilityManager.h
+    Source/Clients/Effects/QualityController.cpp
+    Source/Clients/Effects/QualityController.h
+    Source/Clients/Effects/DirectPathKernel.cpp
+    Source/Clients/Effects/DirectPathKernel.h
+    Source/Clients/Effects/UnspatializedPanner.cpp
+    Source/Clients/Effects/UnspatializedPanner.h
+    Source/Clients/Effects/AmbisonicsBus.cpp
+    Source/Clients/Effects/AmbisonicsBus.h
+    Source/Clients/Effects/SteamAudioSpatialMixer.cpp
+    Source/Clients/Effects/SteamAudioSpatialMixer.h
+    Source/Clients/Effects/SteamAudioSpatialSource.cpp
+    Source/Clients/Effects/SteamAudioSpatialSource.h
+    Source/Clients/Effects/SteamAudioReflectionMixer.cpp
+    Source/Clients/Effects/SteamAudioReflectionMixer.h
+    Source/Clients/Effects/SpatializerPool.cpp
+    Source/Clients/Effects/SpatializerPool.h
+
+    Source/Clients/Hrtf/HrtfFile.cpp
+    Source/Clients/Hrtf/HrtfFile.h
+    Source/Clients/Hrtf/HrtfSwap.h
+
+    Source/Clients/Scene/AcousticMaterials.cpp
+    Source/Clients/Scene/AcousticMaterials.h
+    Source/Clients/Scene/AcousticProbeFile.cpp
+    Source/Clients/Scene/AcousticProbeFile.h
+    Source/Clients/Scene/AcousticSceneBuilder.cpp
+    Source/Clients/Scene/AcousticSceneBuilder.h
+    Source/Clients/Scene/AcousticSceneFile.cpp
+    Source/Clients/Scene/AcousticSceneFile.h
+    Source/Clients/Scene/MappedFile.cpp
+    Source/Clients/Scene/MappedFile.h
+    Source/Clients/Scene/ProbeStreamer.cpp
+    Source/Clients/Scene/ProbeStreamer.h
+
+    Source/Clients/Simulation/SimulationManager.cpp
+    Source/Clients/Simulation/SimulationManager.h
+    Source/Clients/Simulation/SimulationOutputBuffer.h
+    Source/Clients/Simulation/SimulationWorker.cpp
+    Source/Clients/Simulation/SimulationWorker.h
 
     Source/Clients/Types.cpp
+    Source/Clients/AttenuationTable.cpp
+    Source/Clients/PhononAllocator.cpp
+    Source/Clients/PhononAllocator.h
     Source/Clients/Components/Configs/SAPlayerComponentConfig.cpp
     Source/Clients/Components/Configs/SAPlayerComponentConfig.h
     Source/Clients/Components/Controllers/SAPlayerComponentController.cpp
@@ -1,4 +1,6 @@
 
 set(FILES
     Tests/Clients/TuSteamAudioTest.cpp
+    Tests/Clients/SpatialRenderBenchmarks.cpp
+    Tests/Clients/DirectPathBenchmarks.cpp
 )